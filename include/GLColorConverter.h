@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <gl/glcorearb.h>
+
+#include "GLContext.h"
+
+namespace GL
+{
+    class GLFramebufferCache;
+    class GLPlanarTexture;
+    class GLProgram;
+    class GLTexture;
+
+    // planes are separate textures, y is always full size
+    enum class YUVFormat : uint8_t
+    {
+        // y R8, interleaved uv RG8 at half width and height
+        nv12,
+        // y R8, u R8 and v R8 at half width and height
+        i420,
+        // nv12 layout with 10 bit samples in the high bits, y R16, uv RG16, needs GL_EXT_texture_norm16 on es
+        p010,
+        // y, u and v R8, all full size
+        yuv444,
+    };
+
+    enum class ColorSpace : uint8_t
+    {
+        bt601,
+        bt709,
+        bt2020,
+    };
+
+    enum class ColorRange : uint8_t
+    {
+        // y 16-235, uv 16-240 at 8 bit
+        limited,
+        full,
+    };
+
+    // converts between yuv planes and rgba on the gpu, one fragment pass per output texture.
+    // leaves framebuffer, program and the texture units it used bound to 0, the viewport is not restored.
+    // output textures should come from a pool, a framebuffer stays validated for each of the last few targets
+    class GLLoader_EXPORT GLColorConverter
+    {
+    public:
+        explicit GLColorConverter(GLContext* context = GLContext::current_context());
+        ~GLColorConverter();
+
+        GLColorConverter(const GLColorConverter&) = delete;
+        GLColorConverter& operator=(const GLColorConverter&) = delete;
+
+        // planes are y, uv for nv12 / p010 and y, u, v for i420 / yuv444, target is rgba of the y plane size.
+        // chroma planes should sample linearly
+        void to_rgba(YUVFormat format, std::span<GLTexture const* const> planes, GLTexture const& target,
+            ColorSpace space = ColorSpace::bt709, ColorRange range = ColorRange::limited);
+        void to_rgba(GLPlanarTexture const& frame, GLTexture const& target,
+            ColorSpace space = ColorSpace::bt709, ColorRange range = ColorRange::limited);
+        // y is R8 of the source size, uv is RG8 of half size, source should sample linearly
+        void to_nv12(GLTexture const& source, GLTexture const& y, GLTexture const& uv,
+            ColorSpace space = ColorSpace::bt709, ColorRange range = ColorRange::limited);
+
+        static int plane_count(YUVFormat format);
+    private:
+        GLProgram* create_program(const char* fragment) const;
+        void draw(GLTexture const& target);
+    private:
+        GLContext*              m_context       = nullptr;
+        GLProgram*              m_semi_planar   = nullptr;
+        GLProgram*              m_planar        = nullptr;
+        GLProgram*              m_encode        = nullptr;
+        GLFramebufferCache*     m_framebuffers  = nullptr;
+        GLuint                  m_vao           = 0;
+    };
+}
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <gl/glcorearb.h>
+
+#include "GLContext.h"
+#include "GLProgram.h"
+#include "GLShareGroup.h"
+#include "GLVao.h"
+
+namespace GL
+{
+    class GLFramebuffer;
+    class GLFramebufferCache;
+    class GLReadbackQueue;
+    class GLTexture;
+
+    // container objects a replay creates on its own context, framebuffers and vertex arrays aren't shared
+    // across a share group so a recorder can't hand them over. create, use and delete on the replaying thread
+    class GLLoader_EXPORT GLReplayObjects
+    {
+    public:
+        explicit GLReplayObjects(GLContext* context = GLContext::current_context());
+        ~GLReplayObjects();
+
+        GLReplayObjects(const GLReplayObjects&) = delete;
+        GLReplayObjects& operator=(const GLReplayObjects&) = delete;
+
+        [[nodiscard]] GLContext* context() const;
+        // validated once per texture, null when the texture can't be rendered to
+        GLFramebuffer const* framebuffer(GLTexture const& color);
+        GLVao const* vao(MeshType type);
+    private:
+        GLContext*              m_context       = nullptr;
+        GLFramebufferCache*     m_framebuffers  = nullptr;
+        std::vector<GLVao*>     m_vaos;
+    };
+
+    // gl work recorded on any thread without a context and replayed in order by a GLCommandQueue.
+    // commands live in a linear arena that keeps its memory across reset, recording never touches the driver.
+    // objects are referenced, not copied, they must outlive the replay and be shared with the replaying context,
+    // so framebuffers and vertex arrays are named by what they hold and come from GLReplayObjects.
+    // not thread safe, one recorder at a time
+    class GLLoader_EXPORT GLCommandBuffer
+    {
+    public:
+        GLCommandBuffer() = default;
+        GLCommandBuffer(GLCommandBuffer&& other) noexcept;
+        GLCommandBuffer& operator=(GLCommandBuffer&& other) noexcept;
+        GLCommandBuffer(const GLCommandBuffer&) = delete;
+        GLCommandBuffer& operator=(const GLCommandBuffer&) = delete;
+        ~GLCommandBuffer();
+
+        void use_program(GLProgram const* program);
+        template <typename T>
+        void set_uniform(UniformHandle<T> handle, T const& value);
+        void bind_texture(GLuint unit, GLTexture const* texture);
+        // renders into color through a framebuffer of the replaying context, null binds the default framebuffer
+        void bind_framebuffer(GLTexture const* color);
+        // data is copied into the buffer, the caller may free it right after
+        void upload(GLTexture const* texture, std::span<std::byte const> data, GLenum format, GLenum type, int level = 0);
+        void draw(MeshType mesh);
+        void draw_arrays(GLenum mode, GLint first, GLsizei count);
+        void dispatch(GLProgram const* program, uint32_t x, uint32_t y = 1, uint32_t z = 1, GLbitfield barriers = GL_ALL_BARRIER_BITS);
+        // reads the bound read framebuffer
+        void readback(GLReadbackQueue* queue);
+
+        // any callable taking the replaying GLContext*, for work the typed commands don't cover
+        template <typename Func>
+        void record(Func&& func);
+
+        // runs every command on the calling thread's current context
+        void execute(GLContext* context);
+        // same, reusing the framebuffers and vertex arrays of earlier replays
+        void execute(GLReplayObjects& objects);
+        // drops the commands, keeps the memory
+        void reset();
+
+        [[nodiscard]] bool empty() const;
+        [[nodiscard]] size_t command_count() const;
+    private:
+        struct Command
+        {
+            // null for a block of data owned by another command
+            void    (*execute)(void* payload, GLReplayObjects& objects);
+            void    (*destroy)(void* payload);
+            // from this header to the payload and to the next header
+            uint32_t payload_offset;
+            uint32_t size;
+        };
+
+        struct Chunk
+        {
+            std::unique_ptr<std::byte[]>    data;
+            size_t                          capacity    = 0;
+            size_t                          used        = 0;
+        };
+
+        // room for a header and size bytes of payload aligned to alignment, returns the payload
+        void* allocate(size_t size, size_t alignment, void (*execute)(void*, GLReplayObjects&), void (*destroy)(void*));
+        // a callable taking the GLReplayObjects, for commands needing objects of the replaying context
+        template <typename Func>
+        void record_replay(Func&& func);
+        void destroy_commands();
+    private:
+        std::vector<Chunk>  m_chunks;
+        size_t              m_current   = 0;
+        size_t              m_commands  = 0;
+    };
+
+    // owns a context of the share group and a thread that replays submitted buffers one after another.
+    // submit, acquire and wait are thread safe, producers only contend for the moment of handing a buffer over
+    class GLLoader_EXPORT GLCommandQueue
+    {
+    public:
+        explicit GLCommandQueue(GLShareGroup& group = GLShareGroup::default_group());
+        // replays everything already submitted first
+        ~GLCommandQueue();
+
+        GLCommandQueue(const GLCommandQueue&) = delete;
+        GLCommandQueue& operator=(const GLCommandQueue&) = delete;
+
+        // an empty buffer, recycled from earlier submissions when possible
+        GLCommandBuffer acquire();
+        // returns a ticket that wait accepts, buffers are replayed in submission order and flushed after each
+        uint64_t submit(GLCommandBuffer&& buffer);
+        // blocks until the ticket's buffer has been replayed, not until the gpu finished it
+        void wait(uint64_t ticket);
+        void wait_idle();
+
+        // null when creation failed, only current on the queue thread
+        [[nodiscard]] GLContext* context() const;
+    private:
+        void run(GLShareGroup* group);
+    private:
+        GLContext*                      m_context   = nullptr;
+        std::deque<GLCommandBuffer>     m_pending;
+        std::vector<GLCommandBuffer>    m_free;
+        uint64_t                        m_submitted = 0;
+        uint64_t                        m_completed = 0;
+        bool                            m_ready     = false;
+        bool                            m_stop      = false;
+        std::mutex                      m_mutex;
+        std::condition_variable         m_condition;
+        std::condition_variable         m_done;
+        std::thread                     m_thread;
+    };
+
+    template <typename T>
+    void GLCommandBuffer::set_uniform(UniformHandle<T> handle, T const& value)
+    {
+        record([handle, value](GLContext*) { handle.set(value); });
+    }
+
+    template <typename Func>
+    void GLCommandBuffer::record(Func&& func)
+    {
+        record_replay([func = std::forward<Func>(func)](GLReplayObjects& objects) mutable { func(objects.context()); });
+    }
+
+    template <typename Func>
+    void GLCommandBuffer::record_replay(Func&& func)
+    {
+        using Stored = std::decay_t<Func>;
+
+        auto execute = [](void* payload, GLReplayObjects& objects) { (*static_cast<Stored*>(payload))(objects); };
+        void (*destroy)(void*) = nullptr;
+        if constexpr (!std::is_trivially_destructible_v<Stored>)
+            destroy = [](void* payload) { static_cast<Stored*>(payload)->~Stored(); };
+
+        void* payload = allocate(sizeof(Stored), alignof(Stored), execute, destroy);
+        new (payload) Stored(std::forward<Func>(func));
+    }
+}
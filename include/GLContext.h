@@ -4,22 +4,31 @@
 
 #pragma once
 
+#include <cstdint>
+#include <string_view>
+
 #include "GLLoaderExport.h"
 
 namespace GL
 {
     struct GLFunctions;
     struct GLExtFunctions;
+    struct GLExtensions;
+    class GLShareGroup;
+    class GLStateCache;
 
     class GLLoader_EXPORT GLContext
     {
     public:
-        explicit GLContext(bool shared);
+        // share_group is null for an unshared context
+        explicit GLContext(GLShareGroup* share_group);
         virtual ~GLContext();
 
-        virtual bool activate() const = 0;
+        // no-op when this context is already current on the calling thread
+        bool activate() const;
 
-        virtual bool release() const = 0;
+        // no-op when no context is current on the calling thread
+        bool release() const;
 
         virtual bool swap_buffers() const = 0;
 
@@ -29,17 +38,48 @@ namespace GL
 
         [[nodiscard]] GLExtFunctions const* get_ext_func() const;
 
+        // shadow of this context's bindings, only touch it while the context is current
+        [[nodiscard]] GLStateCache* get_state() const;
+
         [[nodiscard]] bool is_shared() const;
 
+        [[nodiscard]] GLShareGroup* share_group() const;
+
+        // core version, e.g. 3 and 2 for an es 3.2 context. the context must be current, false when the driver reports none
+        bool version(int* major, int* minor) const;
+
+        // full extension name, e.g. "GL_EXT_buffer_storage", cheap enough to query per frame
+        [[nodiscard]] bool has_extension(std::string_view name) const;
+
+        // the context last activated on the calling thread, null after release
         static GLContext* current_context();
+
+        // make-current calls that actually reached the driver, across all threads
+        static uint64_t switch_count();
     protected:
-        GLFunctions* m_func = nullptr;
-        GLExtFunctions* m_ext_func = nullptr;
-        bool m_is_shared = false;
+        // platform make-current, only called by activate / release when the current context changes
+        virtual bool make_current() const = 0;
+        virtual bool clear_current() const = 0;
+        // shared with every context on the same driver, owned by the loader
+        GLFunctions const* m_func = nullptr;
+        GLExtFunctions const* m_ext_func = nullptr;
+        GLExtensions const* m_extensions = nullptr;
+        GLShareGroup* m_share_group = nullptr;
+        GLStateCache* m_state = nullptr;
     };
 
-    // this context will be added to shared lists automatically while shared is true
+    // resolve gl entry points on their first call instead of at context creation, call before creating any context.
+    // entry points of the context version and reported extensions are never null in this mode,
+    // use has_extension rather than null checks to detect optional features.
+    // the first call of an entry point patches the table every context reads without synchronization,
+    // so make it on one thread before other threads call the same entry point, e.g. during setup
+    GLLoader_EXPORT void set_lazy_function_loading(bool lazy);
+
+    // the new context is current on the calling thread.
+    // this context will be added to the default share group automatically while shared is true
     GLLoader_EXPORT GLContext* create_offscreen_context(bool shared = true);
+    // shares objects only with other contexts of group
+    GLLoader_EXPORT GLContext* create_offscreen_context(GLShareGroup& group);
     GLLoader_EXPORT void destroy_context(GLContext* context);
 
 }
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "GLContext.h"
+#include "GLShareGroup.h"
+
+namespace GL
+{
+    struct GLContextPoolStats
+    {
+        size_t      capacity        = 0;
+        size_t      in_use          = 0;
+        size_t      peak_in_use     = 0;
+        uint64_t    acquire_count   = 0;
+        // time spent waiting for a free context, excluding activation
+        std::chrono::nanoseconds total_acquire_latency{0};
+        std::chrono::nanoseconds max_acquire_latency{0};
+    };
+
+    // pre-creates offscreen contexts in one share group and lends them to threads,
+    // unlike other GL classes this one is thread safe
+    class GLLoader_EXPORT GLContextPool
+    {
+    public:
+        // the context is current on the acquiring thread for the lifetime of the lease
+        class GLLoader_EXPORT Lease
+        {
+        public:
+            Lease() = default;
+            Lease(Lease&& other) noexcept;
+            Lease& operator=(Lease&& other) noexcept;
+            Lease(const Lease&) = delete;
+            Lease& operator=(const Lease&) = delete;
+            ~Lease();
+
+            [[nodiscard]] GLContext* context() const;
+            GLContext* operator->() const;
+            explicit operator bool() const;
+
+            // resets bindings, releases the context and hands it back to the pool early
+            void reset();
+        private:
+            Lease(GLContextPool* pool, GLContext* context);
+        private:
+            GLContextPool*  m_pool      = nullptr;
+            GLContext*      m_context   = nullptr;
+
+            friend class GLContextPool;
+        };
+
+        explicit GLContextPool(size_t count, GLShareGroup& group = GLShareGroup::default_group());
+        ~GLContextPool();
+
+        GLContextPool(const GLContextPool&) = delete;
+        GLContextPool& operator=(const GLContextPool&) = delete;
+
+        // blocks until a context is free
+        Lease acquire();
+        std::optional<Lease> try_acquire();
+
+        [[nodiscard]] GLContextPoolStats stats() const;
+        [[nodiscard]] size_t capacity() const;
+    private:
+        Lease lease(GLContext* context, std::chrono::steady_clock::time_point start);
+        void give_back(GLContext* context);
+    private:
+        std::vector<GLContext*>     m_contexts;
+        std::vector<GLContext*>     m_free;
+        GLContextPoolStats          m_stats;
+        mutable std::mutex          m_mutex;
+        std::condition_variable     m_condition;
+    };
+}
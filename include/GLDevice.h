@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "GLContext.h"
+
+namespace GL
+{
+    class GLShareGroup;
+
+    // an egl device exposed through EGL_EXT_device_enumeration, always empty on wgl
+    struct GLDevice
+    {
+        // position in the driver's device list, stable for the lifetime of the process
+        int             index = -1;
+        // EGL_EXT_device_drm, e.g. /dev/dri/card0, empty when not a drm device
+        std::string     drm_device;
+        // EGL_EXT_device_drm_render_node, e.g. /dev/dri/renderD128
+        std::string     render_node;
+        // EGL_MESA_device_software, llvmpipe / softpipe
+        bool            software = false;
+    };
+
+    GLLoader_EXPORT std::vector<GLDevice> enumerate_devices();
+
+    // pins the context to device through EGL_EXT_platform_device,
+    // a share group must only hold contexts of the same device
+    GLLoader_EXPORT GLContext* create_offscreen_context(GLDevice const& device, GLShareGroup* group = nullptr);
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <gl/glcorearb.h>
+
+#include "GLContext.h"
+#include "GLShareGroup.h"
+
+namespace GL
+{
+    enum class FenceStatus : uint8_t
+    {
+        signaled,
+        timeout,
+        // the sync is invalid or the context was lost, waiting again won't help
+        failed,
+    };
+
+    // owns a sync object and deletes it on destruction. syncs are shared by the whole share group,
+    // a fence may be waited on and destroyed from any context of it.
+    // the driver only starts signaling once the creating context flushed, do that before another context waits
+    class GLLoader_EXPORT GLFence
+    {
+    public:
+        // fences every command issued so far on the calling thread's context
+        explicit GLFence(GLContext* context = GLContext::current_context());
+        // takes ownership of a sync created by glFenceSync
+        explicit GLFence(GLsync sync, GLContext* context = GLContext::current_context());
+        ~GLFence();
+
+        GLFence(GLFence&& other) noexcept;
+        GLFence& operator=(GLFence&& other) noexcept;
+        GLFence(const GLFence&) = delete;
+        GLFence& operator=(const GLFence&) = delete;
+
+        // blocks the calling thread up to timeout nanoseconds, 0 polls. flushes the calling context first
+        FenceStatus client_wait(GLuint64 timeout = GL_TIMEOUT_IGNORED) const;
+        // makes the calling thread's context wait on the gpu before running later commands, returns right away
+        void server_wait() const;
+        // a query that neither flushes nor blocks
+        [[nodiscard]] bool is_signaled() const;
+
+        [[nodiscard]] GLsync get() const;
+        // gives up ownership, the caller deletes the sync
+        GLsync release();
+        explicit operator bool() const;
+    private:
+        GLContext*  m_context   = nullptr;
+        GLsync      m_sync      = nullptr;
+    };
+
+    // runs a callback once its fence signals, from one thread that polls every watched fence.
+    // lets resources be recycled when the gpu is done with them without any thread blocking on it
+    class GLLoader_EXPORT GLFenceWatcher
+    {
+    public:
+        // the polling thread owns a context of group, fences from any context of it can be watched.
+        // poll_interval is the longest a fence waits for its callback after signaling, in nanoseconds
+        explicit GLFenceWatcher(GLShareGroup& group = GLShareGroup::default_group(), GLuint64 poll_interval = 1000000);
+        // waits for every watched fence and runs its callback
+        ~GLFenceWatcher();
+
+        GLFenceWatcher(const GLFenceWatcher&) = delete;
+        GLFenceWatcher& operator=(const GLFenceWatcher&) = delete;
+
+        // false when the watcher thread couldn't create its context, nothing can be watched then
+        [[nodiscard]] bool valid() const;
+
+        // callback runs on the watcher thread and must not block it. flushes the calling thread's context
+        // so the fence can signal. a fence that fails still runs its callback, its resources would leak otherwise.
+        // an invalid watcher refuses and returns false, the fence is dropped and the callback never runs
+        bool on_signaled(GLFence&& fence, std::function<void()> callback);
+
+        // fences handed over and not yet signaled
+        [[nodiscard]] size_t pending() const;
+    private:
+        struct Watch
+        {
+            GLFence                 fence;
+            std::function<void()>   callback;
+        };
+
+        void run(GLShareGroup* group);
+    private:
+        GLuint64                    m_poll_interval;
+        // handed over by on_signaled, moved to the watcher thread's own list each round
+        std::vector<Watch>          m_incoming;
+        size_t                      m_pending       = 0;
+        bool                        m_ready         = false;
+        bool                        m_valid         = false;
+        bool                        m_stop          = false;
+        mutable std::mutex          m_mutex;
+        std::condition_variable     m_condition;
+        std::thread                 m_thread;
+    };
+}
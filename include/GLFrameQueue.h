@@ -0,0 +1,390 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <gl/glcorearb.h>
+
+namespace GL
+{
+    class GLTexture;
+
+    // a texture handed from one context of a share group to another, sync is signaled once its contents are written
+    struct GLFrame
+    {
+        GLTexture*  texture = nullptr;
+        GLsync      sync    = nullptr;
+    };
+
+    // attempts before a blocking push or pop parks the thread, covers the common case of the other side being mid-call
+    inline constexpr int Queue_Spin_Count = 64;
+    // keeps the producer and consumer indices off each other's cache line
+    inline constexpr size_t Queue_Line_Size = 64;
+
+    // bounded lock-free ring for one producer thread and one consumer thread.
+    // push blocks while the ring is full, pop while it is empty, both park instead of spinning.
+    // nothing unblocks a waiting side but the other one, push a sentinel value to stop a parked consumer
+    template <typename T>
+    class GLSpscQueue
+    {
+    public:
+        // capacity is rounded up to a power of two
+        explicit GLSpscQueue(size_t capacity);
+
+        GLSpscQueue(const GLSpscQueue&) = delete;
+        GLSpscQueue& operator=(const GLSpscQueue&) = delete;
+
+        bool try_push(T value);
+        void push(T value);
+        bool try_pop(T& value);
+        T pop();
+
+        // exact only when called from the producer or consumer while the other is idle
+        [[nodiscard]] size_t size() const;
+        [[nodiscard]] bool empty() const;
+        [[nodiscard]] size_t capacity() const;
+        // blocking pushes / pops that parked the thread, a growing push count means the consumers fall behind
+        [[nodiscard]] uint64_t push_stall_count() const;
+        [[nodiscard]] uint64_t pop_stall_count() const;
+    private:
+        // moves out of value only on success, so a blocking push can retry with it
+        bool push_slot(T& value);
+    private:
+        std::unique_ptr<T[]>                                m_slots;
+        size_t                                              m_mask;
+
+        // next slot to pop, written by the consumer only
+        alignas(Queue_Line_Size) std::atomic<size_t>        m_head      = 0;
+        // consumer's last view of m_tail, saves reading the producer's line on every pop
+        size_t                                              m_tail_seen = 0;
+        std::atomic<uint64_t>                               m_pop_stalls  = 0;
+
+        // next slot to push, written by the producer only
+        alignas(Queue_Line_Size) std::atomic<size_t>        m_tail      = 0;
+        size_t                                              m_head_seen = 0;
+        std::atomic<uint64_t>                               m_push_stalls = 0;
+    };
+
+    // bounded lock-free ring for any number of producers and consumers, each slot carries a sequence number
+    // that tells which lap of the ring it is on. same blocking rules as GLSpscQueue
+    template <typename T>
+    class GLMpmcQueue
+    {
+    public:
+        // capacity is rounded up to a power of two
+        explicit GLMpmcQueue(size_t capacity);
+
+        GLMpmcQueue(const GLMpmcQueue&) = delete;
+        GLMpmcQueue& operator=(const GLMpmcQueue&) = delete;
+
+        bool try_push(T value);
+        void push(T value);
+        bool try_pop(T& value);
+        T pop();
+
+        // a snapshot, may be stale by the time it returns
+        [[nodiscard]] size_t size() const;
+        [[nodiscard]] bool empty() const;
+        [[nodiscard]] size_t capacity() const;
+        // blocking pushes / pops that parked the thread, a growing push count means the consumers fall behind
+        [[nodiscard]] uint64_t push_stall_count() const;
+        [[nodiscard]] uint64_t pop_stall_count() const;
+    private:
+        // moves out of value only on success, so a blocking push can retry with it
+        bool push_slot(T& value);
+    private:
+        struct Slot
+        {
+            // equals the position when free for a push, position + 1 when holding a value
+            std::atomic<size_t>     sequence;
+            T                       value;
+        };
+
+        std::unique_ptr<Slot[]>                             m_slots;
+        size_t                                              m_mask;
+        alignas(Queue_Line_Size) std::atomic<size_t>        m_enqueue   = 0;
+        alignas(Queue_Line_Size) std::atomic<size_t>        m_dequeue   = 0;
+        std::atomic<uint64_t>                               m_push_stalls = 0;
+        std::atomic<uint64_t>                               m_pop_stalls  = 0;
+    };
+
+    template <typename T>
+    GLSpscQueue<T>::GLSpscQueue(size_t capacity)
+    {
+        capacity = std::bit_ceil(std::max<size_t>(capacity, 1));
+        m_slots = std::make_unique<T[]>(capacity);
+        m_mask = capacity - 1;
+    }
+
+    template <typename T>
+    bool GLSpscQueue<T>::try_push(T value)
+    {
+        return push_slot(value);
+    }
+
+    template <typename T>
+    bool GLSpscQueue<T>::push_slot(T& value)
+    {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head_seen > m_mask)
+        {
+            m_head_seen = m_head.load(std::memory_order_acquire);
+            if (tail - m_head_seen > m_mask)
+                return false;
+        }
+
+        m_slots[tail & m_mask] = std::move(value);
+        m_tail.store(tail + 1, std::memory_order_release);
+        m_tail.notify_one();
+        return true;
+    }
+
+    template <typename T>
+    void GLSpscQueue<T>::push(T value)
+    {
+        for (int i = 0; !push_slot(value); i++)
+        {
+            if (i < Queue_Spin_Count)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            // full means the consumer hasn't moved past this head yet, sleep until it does
+            size_t head = m_head.load(std::memory_order_acquire);
+            if (m_tail.load(std::memory_order_relaxed) - head > m_mask)
+            {
+                m_push_stalls.fetch_add(1, std::memory_order_relaxed);
+                m_head.wait(head, std::memory_order_acquire);
+            }
+        }
+    }
+
+    template <typename T>
+    bool GLSpscQueue<T>::try_pop(T& value)
+    {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail_seen)
+        {
+            m_tail_seen = m_tail.load(std::memory_order_acquire);
+            if (head == m_tail_seen)
+                return false;
+        }
+
+        value = std::move(m_slots[head & m_mask]);
+        m_head.store(head + 1, std::memory_order_release);
+        m_head.notify_one();
+        return true;
+    }
+
+    template <typename T>
+    T GLSpscQueue<T>::pop()
+    {
+        T value;
+        for (int i = 0; !try_pop(value); i++)
+        {
+            if (i < Queue_Spin_Count)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            size_t tail = m_tail.load(std::memory_order_acquire);
+            if (m_head.load(std::memory_order_relaxed) == tail)
+            {
+                m_pop_stalls.fetch_add(1, std::memory_order_relaxed);
+                m_tail.wait(tail, std::memory_order_acquire);
+            }
+        }
+        return value;
+    }
+
+    template <typename T>
+    size_t GLSpscQueue<T>::size() const
+    {
+        size_t head = m_head.load(std::memory_order_acquire);
+        return m_tail.load(std::memory_order_acquire) - head;
+    }
+
+    template <typename T>
+    bool GLSpscQueue<T>::empty() const
+    {
+        return size() == 0;
+    }
+
+    template <typename T>
+    size_t GLSpscQueue<T>::capacity() const
+    {
+        return m_mask + 1;
+    }
+
+    template <typename T>
+    uint64_t GLSpscQueue<T>::push_stall_count() const
+    {
+        return m_push_stalls.load(std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    uint64_t GLSpscQueue<T>::pop_stall_count() const
+    {
+        return m_pop_stalls.load(std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    GLMpmcQueue<T>::GLMpmcQueue(size_t capacity)
+    {
+        capacity = std::bit_ceil(std::max<size_t>(capacity, 1));
+        m_slots = std::make_unique<Slot[]>(capacity);
+        m_mask = capacity - 1;
+
+        for (size_t i = 0; i < capacity; i++)
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    bool GLMpmcQueue<T>::try_push(T value)
+    {
+        return push_slot(value);
+    }
+
+    template <typename T>
+    bool GLMpmcQueue<T>::push_slot(T& value)
+    {
+        size_t position = m_enqueue.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = m_slots[position & m_mask];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            auto lap = static_cast<std::ptrdiff_t>(sequence - position);
+
+            if (lap == 0)
+            {
+                if (m_enqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    slot.value = std::move(value);
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    slot.sequence.notify_all();
+                    return true;
+                }
+            }
+            // the slot still holds the value of the previous lap
+            else if (lap < 0)
+                return false;
+            else
+                position = m_enqueue.load(std::memory_order_relaxed);
+        }
+    }
+
+    template <typename T>
+    void GLMpmcQueue<T>::push(T value)
+    {
+        for (int i = 0; !push_slot(value); i++)
+        {
+            if (i < Queue_Spin_Count)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            // sleep on the slot the next push needs until a consumer frees it
+            size_t position = m_enqueue.load(std::memory_order_relaxed);
+            Slot& slot = m_slots[position & m_mask];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            if (static_cast<std::ptrdiff_t>(sequence - position) < 0)
+            {
+                m_push_stalls.fetch_add(1, std::memory_order_relaxed);
+                slot.sequence.wait(sequence, std::memory_order_acquire);
+            }
+        }
+    }
+
+    template <typename T>
+    bool GLMpmcQueue<T>::try_pop(T& value)
+    {
+        size_t position = m_dequeue.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = m_slots[position & m_mask];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            auto lap = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+
+            if (lap == 0)
+            {
+                if (m_dequeue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    value = std::move(slot.value);
+                    // free for the push one lap ahead
+                    slot.sequence.store(position + m_mask + 1, std::memory_order_release);
+                    slot.sequence.notify_all();
+                    return true;
+                }
+            }
+            // nothing pushed into this slot yet
+            else if (lap < 0)
+                return false;
+            else
+                position = m_dequeue.load(std::memory_order_relaxed);
+        }
+    }
+
+    template <typename T>
+    T GLMpmcQueue<T>::pop()
+    {
+        T value;
+        for (int i = 0; !try_pop(value); i++)
+        {
+            if (i < Queue_Spin_Count)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            size_t position = m_dequeue.load(std::memory_order_relaxed);
+            Slot& slot = m_slots[position & m_mask];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            if (static_cast<std::ptrdiff_t>(sequence - (position + 1)) < 0)
+            {
+                m_pop_stalls.fetch_add(1, std::memory_order_relaxed);
+                slot.sequence.wait(sequence, std::memory_order_acquire);
+            }
+        }
+        return value;
+    }
+
+    template <typename T>
+    size_t GLMpmcQueue<T>::size() const
+    {
+        size_t dequeue = m_dequeue.load(std::memory_order_acquire);
+        size_t enqueue = m_enqueue.load(std::memory_order_acquire);
+        return enqueue > dequeue ? enqueue - dequeue : 0;
+    }
+
+    template <typename T>
+    bool GLMpmcQueue<T>::empty() const
+    {
+        return size() == 0;
+    }
+
+    template <typename T>
+    size_t GLMpmcQueue<T>::capacity() const
+    {
+        return m_mask + 1;
+    }
+
+    template <typename T>
+    uint64_t GLMpmcQueue<T>::push_stall_count() const
+    {
+        return m_push_stalls.load(std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    uint64_t GLMpmcQueue<T>::pop_stall_count() const
+    {
+        return m_pop_stalls.load(std::memory_order_relaxed);
+    }
+}
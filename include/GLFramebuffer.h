@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <gl/glcorearb.h>
+
+#include "GLContext.h"
+
+namespace GL
+{
+    class GLTexture;
+
+    // framebuffers are never shared between contexts, create and use one on the same context
+    class GLLoader_EXPORT GLFramebuffer
+    {
+    public:
+        explicit GLFramebuffer(GLContext* context = GLContext::current_context());
+        ~GLFramebuffer();
+
+        GLFramebuffer(const GLFramebuffer&) = delete;
+        GLFramebuffer& operator=(const GLFramebuffer&) = delete;
+
+        // attaches to GL_COLOR_ATTACHMENT0 + index
+        void attach_color(int index, GLTexture const& texture, int level = 0);
+        // depth or depth stencil attachment, picked from the texture format
+        void attach_depth(GLTexture const& texture);
+        // routes fragment outputs to every attached color and checks completeness, call once after attaching
+        bool validate();
+
+        // binds for drawing and reading and sets the viewport to the attachment size
+        void bind() const;
+        void unbind() const;
+
+        [[nodiscard]] GLuint id() const;
+        [[nodiscard]] bool is_complete() const;
+        // smallest size over the attachments
+        [[nodiscard]] int width() const;
+        [[nodiscard]] int height() const;
+    private:
+        void fit(GLTexture const& texture, int level);
+    private:
+        GLContext*          m_context   = nullptr;
+        GLuint              m_id        = 0;
+        std::vector<GLenum> m_draw_buffers;
+        int                 m_width     = 0;
+        int                 m_height    = 0;
+        bool                m_complete  = false;
+    };
+
+    // keeps one validated framebuffer per attachment set, so rendering into a known texture is a single bind.
+    // entries are keyed by texture serial, a deleted texture never matches a new one,
+    // evict it anyway to let the driver free its storage before the entry ages out
+    class GLLoader_EXPORT GLFramebufferCache
+    {
+    public:
+        explicit GLFramebufferCache(size_t capacity = 16, GLContext* context = GLContext::current_context());
+        ~GLFramebufferCache();
+
+        GLFramebufferCache(const GLFramebufferCache&) = delete;
+        GLFramebufferCache& operator=(const GLFramebufferCache&) = delete;
+
+        // colors go to attachments 0..n-1, null when the set is incomplete
+        GLFramebuffer const* get(std::span<GLTexture const* const> colors, GLTexture const* depth = nullptr);
+        GLFramebuffer const* get(GLTexture const& color);
+        // drops every framebuffer the texture is attached to
+        void evict(GLTexture const& texture);
+        void clear();
+
+        [[nodiscard]] size_t size() const;
+        [[nodiscard]] uint64_t hit_count() const;
+        [[nodiscard]] uint64_t miss_count() const;
+    private:
+        struct Entry
+        {
+            std::vector<uint64_t>   colors;
+            uint64_t                depth       = 0;
+            GLFramebuffer*          framebuffer = nullptr;
+            uint64_t                stamp       = 0;
+        };
+    private:
+        GLContext*          m_context   = nullptr;
+        std::vector<Entry>  m_entries;
+        size_t              m_capacity  = 0;
+        uint64_t            m_stamp     = 0;
+        uint64_t            m_hits      = 0;
+        uint64_t            m_misses    = 0;
+    };
+}
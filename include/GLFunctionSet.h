@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "GLContext.h"
+#include "GLFunctions.h"
+#include "GLFunctionVersions.h"
+
+namespace GL
+{
+    // resolve a single entry point from the loaded gl library, valid after the first context is created
+    GLLoader_EXPORT void* get_proc_address(const char* name);
+
+    struct GLVersion
+    {
+        bool es;
+        int major;
+        int minor;
+    };
+
+    template <size_t N>
+    struct GLProcName
+    {
+        char value[N];
+
+        constexpr GLProcName(const char (&str)[N])
+        {
+            std::copy_n(str, N, value);
+        }
+
+        [[nodiscard]] constexpr std::string_view view() const
+        {
+            return {value, N - 1};
+        }
+    };
+
+    template <typename T>
+    struct GLProcTraits;
+
+    template <typename Proc>
+    struct GLProcTraits<Proc GLFunctions::*>
+    {
+        using type = Proc;
+    };
+
+    template <auto Member, GLProcName Name>
+    struct GLProc
+    {
+        using type = typename GLProcTraits<decltype(Member)>::type;
+
+        static constexpr auto member = Member;
+        static constexpr auto name = Name;
+    };
+
+    // names a core entry point for GLFunctionSet, e.g. GL_PROC(glBindTexture)
+#define GL_PROC(name) ::GL::GLProc<&::GL::GLFunctions::name, #name>
+
+    template <auto A, auto B>
+    inline constexpr bool GLSameMember = false;
+
+    template <auto A>
+    inline constexpr bool GLSameMember<A, A> = true;
+
+    constexpr bool version_provides(GLVersion version, std::string_view name)
+    {
+        GLFunctionVersion const* first = find_function_version(name);
+        if (first == nullptr)
+            return false;
+
+        int major = version.es ? first->es_major : first->gl_major;
+        int minor = version.es ? first->es_minor : first->gl_minor;
+        if (major == 0)
+            return false;
+
+        return version.major > major || (version.major == major && version.minor >= minor);
+    }
+
+    template <GLVersion Version, typename Proc>
+    struct GLProcAvailable
+    {
+        static_assert(version_provides(Version, Proc::name.view()), "entry point is not provided by the requested gl version");
+        static constexpr bool value = true;
+    };
+
+    // dense table holding only the entry points an application declares, e.g.
+    //     using Functions = GL::GLFunctionSet<GL::GLVersion{true, 3, 1}, GL_PROC(glBindTexture), GL_PROC(glTexSubImage2D)>;
+    // every entry point is checked against the requested version at compile time
+    template <GLVersion Version, typename... Procs>
+    class GLFunctionSet
+    {
+        static_assert(sizeof...(Procs) > 0, "function set must declare at least one entry point");
+        static_assert((GLProcAvailable<Version, Procs>::value && ...));
+    public:
+        // resolves only the declared entry points, false if the context api differs, its version is lower than Version
+        // or a symbol is missing. the context must be current
+        bool load(GLContext const* context = GLContext::current_context());
+
+        // e.g. functions.get<&GL::GLFunctions::glBindTexture>()(GL_TEXTURE_2D, id)
+        template <auto Member>
+        [[nodiscard]] auto get() const;
+    private:
+        template <auto Member>
+        static constexpr size_t index_of();
+
+        template <size_t... I>
+        bool load(std::index_sequence<I...>);
+    private:
+        std::tuple<typename Procs::type...> m_procs{};
+    };
+
+    template <GLVersion Version, typename... Procs>
+    bool GLFunctionSet<Version, Procs...>::load(GLContext const* context)
+    {
+        if (context == nullptr || context->is_opengl_es() != Version.es)
+            return false;
+
+        // egl and glx hand out addresses for names the context doesn't support, only the version tells
+        int major = 0, minor = 0;
+        if (!context->version(&major, &minor) || major < Version.major || (major == Version.major && minor < Version.minor))
+            return false;
+
+        return load(std::index_sequence_for<Procs...>{});
+    }
+
+    template <GLVersion Version, typename... Procs>
+    template <size_t... I>
+    bool GLFunctionSet<Version, Procs...>::load(std::index_sequence<I...>)
+    {
+        bool result = true;
+        ((std::get<I>(m_procs) = (typename Procs::type)get_proc_address(Procs::name.value),
+          result = result && std::get<I>(m_procs) != nullptr), ...);
+        return result;
+    }
+
+    template <GLVersion Version, typename... Procs>
+    template <auto Member>
+    constexpr size_t GLFunctionSet<Version, Procs...>::index_of()
+    {
+        constexpr bool matches[] = {GLSameMember<Member, Procs::member>...};
+        for (size_t i = 0; i < sizeof...(Procs); i++)
+        {
+            if (matches[i])
+                return i;
+        }
+        return sizeof...(Procs);
+    }
+
+    template <GLVersion Version, typename... Procs>
+    template <auto Member>
+    auto GLFunctionSet<Version, Procs...>::get() const
+    {
+        constexpr size_t index = index_of<Member>();
+        static_assert(index < sizeof...(Procs), "entry point is not declared in this function set");
+        if constexpr (index < sizeof...(Procs))
+            return std::get<index>(m_procs);
+    }
+}
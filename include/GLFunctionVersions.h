@@ -0,0 +1,691 @@
+#pragma once
+
+#include <algorithm>
+#include <string_view>
+
+namespace GL
+{
+    // first core version providing an entry point, 0.0 when the api never provides it
+    struct GLFunctionVersion
+    {
+        std::string_view name;
+        int gl_major;
+        int gl_minor;
+        int es_major;
+        int es_minor;
+    };
+
+    // sorted by name, generated from the version loaders
+    inline constexpr GLFunctionVersion GLFunctionVersions[] =
+    {
+        {"glActiveShaderProgram",                         4, 1, 3, 1},
+        {"glActiveTexture",                               1, 3, 2, 0},
+        {"glAttachShader",                                2, 0, 2, 0},
+        {"glBeginConditionalRender",                      3, 0, 0, 0},
+        {"glBeginQuery",                                  1, 5, 3, 0},
+        {"glBeginQueryIndexed",                           3, 3, 0, 0},
+        {"glBeginTransformFeedback",                      3, 0, 3, 0},
+        {"glBindAttribLocation",                          2, 0, 2, 0},
+        {"glBindBuffer",                                  1, 5, 2, 0},
+        {"glBindBufferBase",                              3, 0, 3, 0},
+        {"glBindBufferRange",                             3, 0, 3, 0},
+        {"glBindBuffersBase",                             4, 4, 0, 0},
+        {"glBindBuffersRange",                            4, 4, 0, 0},
+        {"glBindFragDataLocation",                        3, 0, 0, 0},
+        {"glBindFragDataLocationIndexed",                 3, 3, 0, 0},
+        {"glBindFramebuffer",                             3, 0, 2, 0},
+        {"glBindImageTexture",                            4, 2, 3, 1},
+        {"glBindImageTextures",                           4, 4, 0, 0},
+        {"glBindProgramPipeline",                         4, 1, 3, 1},
+        {"glBindRenderbuffer",                            3, 0, 2, 0},
+        {"glBindSampler",                                 3, 3, 3, 0},
+        {"glBindSamplers",                                4, 4, 0, 0},
+        {"glBindTexture",                                 1, 1, 2, 0},
+        {"glBindTextureUnit",                             4, 5, 0, 0},
+        {"glBindTextures",                                4, 4, 0, 0},
+        {"glBindTransformFeedback",                       3, 3, 3, 0},
+        {"glBindVertexArray",                             3, 0, 3, 0},
+        {"glBindVertexBuffer",                            4, 3, 3, 1},
+        {"glBindVertexBuffers",                           4, 4, 0, 0},
+        {"glBlendBarrier",                                0, 0, 3, 2},
+        {"glBlendColor",                                  1, 4, 2, 0},
+        {"glBlendEquation",                               1, 4, 2, 0},
+        {"glBlendEquationSeparate",                       2, 0, 2, 0},
+        {"glBlendEquationSeparatei",                      3, 3, 3, 2},
+        {"glBlendEquationi",                              3, 3, 3, 2},
+        {"glBlendFunc",                                   1, 0, 2, 0},
+        {"glBlendFuncSeparate",                           1, 4, 2, 0},
+        {"glBlendFuncSeparatei",                          3, 3, 3, 2},
+        {"glBlendFunci",                                  3, 3, 3, 2},
+        {"glBlitFramebuffer",                             3, 0, 3, 0},
+        {"glBlitNamedFramebuffer",                        4, 5, 0, 0},
+        {"glBufferData",                                  1, 5, 2, 0},
+        {"glBufferStorage",                               4, 4, 0, 0},
+        {"glBufferSubData",                               1, 5, 2, 0},
+        {"glCheckFramebufferStatus",                      3, 0, 2, 0},
+        {"glCheckNamedFramebufferStatus",                 4, 5, 0, 0},
+        {"glClampColor",                                  3, 0, 0, 0},
+        {"glClear",                                       1, 0, 2, 0},
+        {"glClearBufferData",                             4, 3, 0, 0},
+        {"glClearBufferSubData",                          4, 3, 0, 0},
+        {"glClearBufferfi",                               3, 0, 3, 0},
+        {"glClearBufferfv",                               3, 0, 3, 0},
+        {"glClearBufferiv",                               3, 0, 3, 0},
+        {"glClearBufferuiv",                              3, 0, 3, 0},
+        {"glClearColor",                                  1, 0, 2, 0},
+        {"glClearDepth",                                  1, 0, 0, 0},
+        {"glClearDepthf",                                 4, 1, 2, 0},
+        {"glClearNamedBufferData",                        4, 5, 0, 0},
+        {"glClearNamedBufferSubData",                     4, 5, 0, 0},
+        {"glClearNamedFramebufferfi",                     4, 5, 0, 0},
+        {"glClearNamedFramebufferfv",                     4, 5, 0, 0},
+        {"glClearNamedFramebufferiv",                     4, 5, 0, 0},
+        {"glClearNamedFramebufferuiv",                    4, 5, 0, 0},
+        {"glClearStencil",                                1, 0, 2, 0},
+        {"glClearTexImage",                               4, 4, 0, 0},
+        {"glClearTexSubImage",                            4, 4, 0, 0},
+        {"glClientWaitSync",                              3, 2, 3, 0},
+        {"glClipControl",                                 4, 5, 0, 0},
+        {"glColorMask",                                   1, 0, 2, 0},
+        {"glColorMaski",                                  3, 0, 3, 2},
+        {"glCompileShader",                               2, 0, 2, 0},
+        {"glCompressedTexImage1D",                        1, 3, 0, 0},
+        {"glCompressedTexImage2D",                        1, 3, 2, 0},
+        {"glCompressedTexImage3D",                        1, 3, 3, 0},
+        {"glCompressedTexSubImage1D",                     1, 3, 0, 0},
+        {"glCompressedTexSubImage2D",                     1, 3, 2, 0},
+        {"glCompressedTexSubImage3D",                     1, 3, 3, 0},
+        {"glCompressedTextureSubImage1D",                 4, 5, 0, 0},
+        {"glCompressedTextureSubImage2D",                 4, 5, 0, 0},
+        {"glCompressedTextureSubImage3D",                 4, 5, 0, 0},
+        {"glCopyBufferSubData",                           3, 1, 3, 0},
+        {"glCopyImageSubData",                            4, 3, 3, 2},
+        {"glCopyNamedBufferSubData",                      4, 5, 0, 0},
+        {"glCopyTexImage1D",                              1, 1, 0, 0},
+        {"glCopyTexImage2D",                              1, 1, 2, 0},
+        {"glCopyTexSubImage1D",                           1, 1, 0, 0},
+        {"glCopyTexSubImage2D",                           1, 1, 2, 0},
+        {"glCopyTexSubImage3D",                           1, 2, 3, 0},
+        {"glCopyTextureSubImage1D",                       4, 5, 0, 0},
+        {"glCopyTextureSubImage2D",                       4, 5, 0, 0},
+        {"glCopyTextureSubImage3D",                       4, 5, 0, 0},
+        {"glCreateBuffers",                               4, 5, 0, 0},
+        {"glCreateFramebuffers",                          4, 5, 0, 0},
+        {"glCreateProgram",                               2, 0, 2, 0},
+        {"glCreateProgramPipelines",                      4, 5, 0, 0},
+        {"glCreateQueries",                               4, 5, 0, 0},
+        {"glCreateRenderbuffers",                         4, 5, 0, 0},
+        {"glCreateSamplers",                              4, 5, 0, 0},
+        {"glCreateShader",                                2, 0, 2, 0},
+        {"glCreateShaderProgramv",                        4, 1, 3, 1},
+        {"glCreateTextures",                              4, 5, 0, 0},
+        {"glCreateTransformFeedbacks",                    4, 5, 0, 0},
+        {"glCreateVertexArrays",                          4, 5, 0, 0},
+        {"glCullFace",                                    1, 0, 2, 0},
+        {"glDebugMessageCallback",                        4, 3, 3, 2},
+        {"glDebugMessageControl",                         4, 3, 3, 2},
+        {"glDebugMessageInsert",                          4, 3, 3, 2},
+        {"glDeleteBuffers",                               1, 5, 2, 0},
+        {"glDeleteFramebuffers",                          3, 0, 2, 0},
+        {"glDeleteProgram",                               2, 0, 2, 0},
+        {"glDeleteProgramPipelines",                      4, 1, 3, 1},
+        {"glDeleteQueries",                               1, 5, 3, 0},
+        {"glDeleteRenderbuffers",                         3, 0, 2, 0},
+        {"glDeleteSamplers",                              3, 3, 3, 0},
+        {"glDeleteShader",                                2, 0, 2, 0},
+        {"glDeleteSync",                                  3, 2, 3, 0},
+        {"glDeleteTextures",                              1, 1, 2, 0},
+        {"glDeleteTransformFeedbacks",                    3, 3, 3, 0},
+        {"glDeleteVertexArrays",                          3, 0, 3, 0},
+        {"glDepthFunc",                                   1, 0, 2, 0},
+        {"glDepthMask",                                   1, 0, 2, 0},
+        {"glDepthRange",                                  1, 0, 0, 0},
+        {"glDepthRangeArrayv",                            4, 1, 0, 0},
+        {"glDepthRangeIndexed",                           4, 1, 0, 0},
+        {"glDepthRangef",                                 4, 1, 2, 0},
+        {"glDetachShader",                                2, 0, 2, 0},
+        {"glDisable",                                     1, 0, 2, 0},
+        {"glDisableVertexArrayAttrib",                    4, 5, 0, 0},
+        {"glDisableVertexAttribArray",                    2, 0, 2, 0},
+        {"glDisablei",                                    3, 0, 3, 2},
+        {"glDispatchCompute",                             4, 3, 3, 1},
+        {"glDispatchComputeIndirect",                     4, 3, 3, 1},
+        {"glDrawArrays",                                  1, 1, 2, 0},
+        {"glDrawArraysIndirect",                          3, 3, 3, 1},
+        {"glDrawArraysInstanced",                         3, 1, 3, 0},
+        {"glDrawArraysInstancedBaseInstance",             4, 2, 0, 0},
+        {"glDrawBuffer",                                  1, 0, 0, 0},
+        {"glDrawBuffers",                                 2, 0, 3, 0},
+        {"glDrawElements",                                1, 1, 2, 0},
+        {"glDrawElementsBaseVertex",                      3, 2, 3, 2},
+        {"glDrawElementsIndirect",                        3, 3, 3, 1},
+        {"glDrawElementsInstanced",                       3, 1, 3, 0},
+        {"glDrawElementsInstancedBaseInstance",           4, 2, 0, 0},
+        {"glDrawElementsInstancedBaseVertex",             3, 2, 3, 2},
+        {"glDrawElementsInstancedBaseVertexBaseInstance", 4, 2, 0, 0},
+        {"glDrawRangeElements",                           1, 2, 3, 0},
+        {"glDrawRangeElementsBaseVertex",                 3, 2, 3, 2},
+        {"glDrawTransformFeedback",                       3, 3, 0, 0},
+        {"glDrawTransformFeedbackInstanced",              4, 2, 0, 0},
+        {"glDrawTransformFeedbackStream",                 3, 3, 0, 0},
+        {"glDrawTransformFeedbackStreamInstanced",        4, 2, 0, 0},
+        {"glEnable",                                      1, 0, 2, 0},
+        {"glEnableVertexArrayAttrib",                     4, 5, 0, 0},
+        {"glEnableVertexAttribArray",                     2, 0, 2, 0},
+        {"glEnablei",                                     3, 0, 3, 2},
+        {"glEndConditionalRender",                        3, 0, 0, 0},
+        {"glEndQuery",                                    1, 5, 3, 0},
+        {"glEndQueryIndexed",                             3, 3, 0, 0},
+        {"glEndTransformFeedback",                        3, 0, 3, 0},
+        {"glFenceSync",                                   3, 2, 3, 0},
+        {"glFinish",                                      1, 0, 2, 0},
+        {"glFlush",                                       1, 0, 2, 0},
+        {"glFlushMappedBufferRange",                      3, 0, 3, 0},
+        {"glFlushMappedNamedBufferRange",                 4, 5, 0, 0},
+        {"glFramebufferParameteri",                       4, 3, 3, 1},
+        {"glFramebufferRenderbuffer",                     3, 0, 2, 0},
+        {"glFramebufferTexture",                          3, 2, 3, 2},
+        {"glFramebufferTexture1D",                        3, 0, 0, 0},
+        {"glFramebufferTexture2D",                        3, 0, 2, 0},
+        {"glFramebufferTexture3D",                        3, 0, 0, 0},
+        {"glFramebufferTextureLayer",                     3, 0, 3, 0},
+        {"glFrontFace",                                   1, 0, 2, 0},
+        {"glGenBuffers",                                  1, 5, 2, 0},
+        {"glGenFramebuffers",                             3, 0, 2, 0},
+        {"glGenProgramPipelines",                         4, 1, 3, 1},
+        {"glGenQueries",                                  1, 5, 3, 0},
+        {"glGenRenderbuffers",                            3, 0, 2, 0},
+        {"glGenSamplers",                                 3, 3, 3, 0},
+        {"glGenTextures",                                 1, 1, 2, 0},
+        {"glGenTransformFeedbacks",                       3, 3, 3, 0},
+        {"glGenVertexArrays",                             3, 0, 3, 0},
+        {"glGenerateMipmap",                              3, 0, 2, 0},
+        {"glGenerateTextureMipmap",                       4, 5, 0, 0},
+        {"glGetActiveAtomicCounterBufferiv",              4, 2, 0, 0},
+        {"glGetActiveAttrib",                             2, 0, 2, 0},
+        {"glGetActiveSubroutineName",                     3, 3, 0, 0},
+        {"glGetActiveSubroutineUniformName",              3, 3, 0, 0},
+        {"glGetActiveSubroutineUniformiv",                3, 3, 0, 0},
+        {"glGetActiveUniform",                            2, 0, 2, 0},
+        {"glGetActiveUniformBlockName",                   3, 1, 3, 0},
+        {"glGetActiveUniformBlockiv",                     3, 1, 3, 0},
+        {"glGetActiveUniformName",                        3, 1, 0, 0},
+        {"glGetActiveUniformsiv",                         3, 1, 3, 0},
+        {"glGetAttachedShaders",                          2, 0, 2, 0},
+        {"glGetAttribLocation",                           2, 0, 2, 0},
+        {"glGetBooleani_v",                               3, 0, 3, 1},
+        {"glGetBooleanv",                                 1, 0, 2, 0},
+        {"glGetBufferParameteri64v",                      3, 2, 3, 0},
+        {"glGetBufferParameteriv",                        1, 5, 2, 0},
+        {"glGetBufferPointerv",                           1, 5, 3, 0},
+        {"glGetBufferSubData",                            1, 5, 0, 0},
+        {"glGetCompressedTexImage",                       1, 3, 0, 0},
+        {"glGetCompressedTextureImage",                   4, 5, 0, 0},
+        {"glGetCompressedTextureSubImage",                4, 5, 0, 0},
+        {"glGetDebugMessageLog",                          4, 3, 3, 2},
+        {"glGetDoublei_v",                                4, 1, 0, 0},
+        {"glGetDoublev",                                  1, 0, 0, 0},
+        {"glGetError",                                    1, 0, 2, 0},
+        {"glGetFloati_v",                                 4, 1, 0, 0},
+        {"glGetFloatv",                                   1, 0, 2, 0},
+        {"glGetFragDataIndex",                            3, 3, 0, 0},
+        {"glGetFragDataLocation",                         3, 0, 3, 0},
+        {"glGetFramebufferAttachmentParameteriv",         3, 0, 2, 0},
+        {"glGetFramebufferParameteriv",                   4, 3, 3, 1},
+        {"glGetGraphicsResetStatus",                      4, 5, 3, 2},
+        {"glGetInteger64i_v",                             3, 2, 3, 0},
+        {"glGetInteger64v",                               3, 2, 3, 0},
+        {"glGetIntegeri_v",                               3, 0, 3, 0},
+        {"glGetIntegerv",                                 1, 0, 2, 0},
+        {"glGetInternalformati64v",                       4, 3, 0, 0},
+        {"glGetInternalformativ",                         4, 2, 3, 0},
+        {"glGetMultisamplefv",                            3, 2, 3, 1},
+        {"glGetNamedBufferParameteri64v",                 4, 5, 0, 0},
+        {"glGetNamedBufferParameteriv",                   4, 5, 0, 0},
+        {"glGetNamedBufferPointerv",                      4, 5, 0, 0},
+        {"glGetNamedBufferSubData",                       4, 5, 0, 0},
+        {"glGetNamedFramebufferAttachmentParameteriv",    4, 5, 0, 0},
+        {"glGetNamedFramebufferParameteriv",              4, 5, 0, 0},
+        {"glGetNamedRenderbufferParameteriv",             4, 5, 0, 0},
+        {"glGetObjectLabel",                              4, 3, 3, 2},
+        {"glGetObjectPtrLabel",                           4, 3, 3, 2},
+        {"glGetPointerv",                                 4, 3, 3, 2},
+        {"glGetProgramBinary",                            4, 1, 3, 0},
+        {"glGetProgramInfoLog",                           2, 0, 2, 0},
+        {"glGetProgramInterfaceiv",                       4, 3, 3, 1},
+        {"glGetProgramPipelineInfoLog",                   4, 1, 3, 1},
+        {"glGetProgramPipelineiv",                        4, 1, 3, 1},
+        {"glGetProgramResourceIndex",                     4, 3, 3, 1},
+        {"glGetProgramResourceLocation",                  4, 3, 3, 1},
+        {"glGetProgramResourceLocationIndex",             4, 3, 0, 0},
+        {"glGetProgramResourceName",                      4, 3, 3, 1},
+        {"glGetProgramResourceiv",                        4, 3, 3, 1},
+        {"glGetProgramStageiv",                           3, 3, 0, 0},
+        {"glGetProgramiv",                                2, 0, 2, 0},
+        {"glGetQueryBufferObjecti64v",                    4, 5, 0, 0},
+        {"glGetQueryBufferObjectiv",                      4, 5, 0, 0},
+        {"glGetQueryBufferObjectui64v",                   4, 5, 0, 0},
+        {"glGetQueryBufferObjectuiv",                     4, 5, 0, 0},
+        {"glGetQueryIndexediv",                           3, 3, 0, 0},
+        {"glGetQueryObjecti64v",                          3, 3, 0, 0},
+        {"glGetQueryObjectiv",                            1, 5, 0, 0},
+        {"glGetQueryObjectui64v",                         3, 3, 0, 0},
+        {"glGetQueryObjectuiv",                           1, 5, 3, 0},
+        {"glGetQueryiv",                                  1, 5, 3, 0},
+        {"glGetRenderbufferParameteriv",                  3, 0, 2, 0},
+        {"glGetSamplerParameterIiv",                      3, 3, 3, 2},
+        {"glGetSamplerParameterIuiv",                     3, 3, 3, 2},
+        {"glGetSamplerParameterfv",                       3, 3, 3, 0},
+        {"glGetSamplerParameteriv",                       3, 3, 3, 0},
+        {"glGetShaderInfoLog",                            2, 0, 2, 0},
+        {"glGetShaderPrecisionFormat",                    4, 1, 2, 0},
+        {"glGetShaderSource",                             2, 0, 2, 0},
+        {"glGetShaderiv",                                 2, 0, 2, 0},
+        {"glGetString",                                   1, 0, 2, 0},
+        {"glGetStringi",                                  3, 0, 3, 0},
+        {"glGetSubroutineIndex",                          3, 3, 0, 0},
+        {"glGetSubroutineUniformLocation",                3, 3, 0, 0},
+        {"glGetSynciv",                                   3, 2, 3, 0},
+        {"glGetTexImage",                                 1, 0, 0, 0},
+        {"glGetTexLevelParameterfv",                      1, 0, 3, 1},
+        {"glGetTexLevelParameteriv",                      1, 0, 3, 1},
+        {"glGetTexParameterIiv",                          3, 0, 3, 2},
+        {"glGetTexParameterIuiv",                         3, 0, 3, 2},
+        {"glGetTexParameterfv",                           1, 0, 2, 0},
+        {"glGetTexParameteriv",                           1, 0, 2, 0},
+        {"glGetTextureImage",                             4, 5, 0, 0},
+        {"glGetTextureLevelParameterfv",                  4, 5, 0, 0},
+        {"glGetTextureLevelParameteriv",                  4, 5, 0, 0},
+        {"glGetTextureParameterIiv",                      4, 5, 0, 0},
+        {"glGetTextureParameterIuiv",                     4, 5, 0, 0},
+        {"glGetTextureParameterfv",                       4, 5, 0, 0},
+        {"glGetTextureParameteriv",                       4, 5, 0, 0},
+        {"glGetTextureSubImage",                          4, 5, 0, 0},
+        {"glGetTransformFeedbackVarying",                 3, 0, 3, 0},
+        {"glGetTransformFeedbacki64_v",                   4, 5, 0, 0},
+        {"glGetTransformFeedbacki_v",                     4, 5, 0, 0},
+        {"glGetTransformFeedbackiv",                      4, 5, 0, 0},
+        {"glGetUniformBlockIndex",                        3, 1, 3, 0},
+        {"glGetUniformIndices",                           3, 1, 3, 0},
+        {"glGetUniformLocation",                          2, 0, 2, 0},
+        {"glGetUniformSubroutineuiv",                     3, 3, 0, 0},
+        {"glGetUniformdv",                                3, 3, 0, 0},
+        {"glGetUniformfv",                                2, 0, 2, 0},
+        {"glGetUniformiv",                                2, 0, 2, 0},
+        {"glGetUniformuiv",                               3, 0, 3, 0},
+        {"glGetVertexArrayIndexed64iv",                   4, 5, 0, 0},
+        {"glGetVertexArrayIndexediv",                     4, 5, 0, 0},
+        {"glGetVertexArrayiv",                            4, 5, 0, 0},
+        {"glGetVertexAttribIiv",                          3, 0, 3, 0},
+        {"glGetVertexAttribIuiv",                         3, 0, 3, 0},
+        {"glGetVertexAttribLdv",                          4, 1, 0, 0},
+        {"glGetVertexAttribPointerv",                     2, 0, 2, 0},
+        {"glGetVertexAttribdv",                           2, 0, 0, 0},
+        {"glGetVertexAttribfv",                           2, 0, 2, 0},
+        {"glGetVertexAttribiv",                           2, 0, 2, 0},
+        {"glGetnCompressedTexImage",                      4, 5, 0, 0},
+        {"glGetnTexImage",                                4, 5, 0, 0},
+        {"glGetnUniformdv",                               4, 5, 0, 0},
+        {"glGetnUniformfv",                               4, 5, 3, 2},
+        {"glGetnUniformiv",                               4, 5, 3, 2},
+        {"glGetnUniformuiv",                              4, 5, 3, 2},
+        {"glHint",                                        1, 0, 2, 0},
+        {"glInvalidateBufferData",                        4, 3, 0, 0},
+        {"glInvalidateBufferSubData",                     4, 3, 0, 0},
+        {"glInvalidateFramebuffer",                       4, 3, 3, 0},
+        {"glInvalidateNamedFramebufferData",              4, 5, 0, 0},
+        {"glInvalidateNamedFramebufferSubData",           4, 5, 0, 0},
+        {"glInvalidateSubFramebuffer",                    4, 3, 3, 0},
+        {"glInvalidateTexImage",                          4, 3, 0, 0},
+        {"glInvalidateTexSubImage",                       4, 3, 0, 0},
+        {"glIsBuffer",                                    1, 5, 2, 0},
+        {"glIsEnabled",                                   1, 0, 2, 0},
+        {"glIsEnabledi",                                  3, 0, 3, 2},
+        {"glIsFramebuffer",                               3, 0, 2, 0},
+        {"glIsProgram",                                   2, 0, 2, 0},
+        {"glIsProgramPipeline",                           4, 1, 3, 1},
+        {"glIsQuery",                                     1, 5, 3, 0},
+        {"glIsRenderbuffer",                              3, 0, 2, 0},
+        {"glIsSampler",                                   3, 3, 3, 0},
+        {"glIsShader",                                    2, 0, 2, 0},
+        {"glIsSync",                                      3, 2, 3, 0},
+        {"glIsTexture",                                   1, 1, 2, 0},
+        {"glIsTransformFeedback",                         3, 3, 3, 0},
+        {"glIsVertexArray",                               3, 0, 3, 0},
+        {"glLineWidth",                                   1, 0, 2, 0},
+        {"glLinkProgram",                                 2, 0, 2, 0},
+        {"glLogicOp",                                     1, 0, 0, 0},
+        {"glMapBuffer",                                   1, 5, 0, 0},
+        {"glMapBufferRange",                              3, 0, 3, 0},
+        {"glMapNamedBuffer",                              4, 5, 0, 0},
+        {"glMapNamedBufferRange",                         4, 5, 0, 0},
+        {"glMemoryBarrier",                               4, 2, 3, 1},
+        {"glMemoryBarrierByRegion",                       4, 5, 3, 1},
+        {"glMinSampleShading",                            3, 3, 3, 2},
+        {"glMultiDrawArrays",                             1, 4, 0, 0},
+        {"glMultiDrawArraysIndirect",                     4, 3, 0, 0},
+        {"glMultiDrawArraysIndirectCount",                4, 6, 0, 0},
+        {"glMultiDrawElements",                           1, 4, 0, 0},
+        {"glMultiDrawElementsBaseVertex",                 3, 2, 0, 0},
+        {"glMultiDrawElementsIndirect",                   4, 3, 0, 0},
+        {"glMultiDrawElementsIndirectCount",              4, 6, 0, 0},
+        {"glNamedBufferData",                             4, 5, 0, 0},
+        {"glNamedBufferStorage",                          4, 5, 0, 0},
+        {"glNamedBufferSubData",                          4, 5, 0, 0},
+        {"glNamedFramebufferDrawBuffer",                  4, 5, 0, 0},
+        {"glNamedFramebufferDrawBuffers",                 4, 5, 0, 0},
+        {"glNamedFramebufferParameteri",                  4, 5, 0, 0},
+        {"glNamedFramebufferReadBuffer",                  4, 5, 0, 0},
+        {"glNamedFramebufferRenderbuffer",                4, 5, 0, 0},
+        {"glNamedFramebufferTexture",                     4, 5, 0, 0},
+        {"glNamedFramebufferTextureLayer",                4, 5, 0, 0},
+        {"glNamedRenderbufferStorage",                    4, 5, 0, 0},
+        {"glNamedRenderbufferStorageMultisample",         4, 5, 0, 0},
+        {"glObjectLabel",                                 4, 3, 3, 2},
+        {"glObjectPtrLabel",                              4, 3, 3, 2},
+        {"glPatchParameterfv",                            3, 3, 0, 0},
+        {"glPatchParameteri",                             3, 3, 3, 2},
+        {"glPauseTransformFeedback",                      3, 3, 3, 0},
+        {"glPixelStoref",                                 1, 0, 0, 0},
+        {"glPixelStorei",                                 1, 0, 2, 0},
+        {"glPointParameterf",                             1, 4, 0, 0},
+        {"glPointParameterfv",                            1, 4, 0, 0},
+        {"glPointParameteri",                             1, 4, 0, 0},
+        {"glPointParameteriv",                            1, 4, 0, 0},
+        {"glPointSize",                                   1, 0, 0, 0},
+        {"glPolygonMode",                                 1, 0, 0, 0},
+        {"glPolygonOffset",                               1, 1, 2, 0},
+        {"glPolygonOffsetClamp",                          4, 6, 0, 0},
+        {"glPopDebugGroup",                               4, 3, 3, 2},
+        {"glPrimitiveBoundingBox",                        0, 0, 3, 2},
+        {"glPrimitiveRestartIndex",                       3, 1, 0, 0},
+        {"glProgramBinary",                               4, 1, 3, 0},
+        {"glProgramParameteri",                           4, 1, 3, 0},
+        {"glProgramUniform1d",                            4, 1, 0, 0},
+        {"glProgramUniform1dv",                           4, 1, 0, 0},
+        {"glProgramUniform1f",                            4, 1, 3, 1},
+        {"glProgramUniform1fv",                           4, 1, 3, 1},
+        {"glProgramUniform1i",                            4, 1, 3, 1},
+        {"glProgramUniform1iv",                           4, 1, 3, 1},
+        {"glProgramUniform1ui",                           4, 1, 3, 1},
+        {"glProgramUniform1uiv",                          4, 1, 3, 1},
+        {"glProgramUniform2d",                            4, 1, 0, 0},
+        {"glProgramUniform2dv",                           4, 1, 0, 0},
+        {"glProgramUniform2f",                            4, 1, 3, 1},
+        {"glProgramUniform2fv",                           4, 1, 3, 1},
+        {"glProgramUniform2i",                            4, 1, 3, 1},
+        {"glProgramUniform2iv",                           4, 1, 3, 1},
+        {"glProgramUniform2ui",                           4, 1, 3, 1},
+        {"glProgramUniform2uiv",                          4, 1, 3, 1},
+        {"glProgramUniform3d",                            4, 1, 0, 0},
+        {"glProgramUniform3dv",                           4, 1, 0, 0},
+        {"glProgramUniform3f",                            4, 1, 3, 1},
+        {"glProgramUniform3fv",                           4, 1, 3, 1},
+        {"glProgramUniform3i",                            4, 1, 3, 1},
+        {"glProgramUniform3iv",                           4, 1, 3, 1},
+        {"glProgramUniform3ui",                           4, 1, 3, 1},
+        {"glProgramUniform3uiv",                          4, 1, 3, 1},
+        {"glProgramUniform4d",                            4, 1, 0, 0},
+        {"glProgramUniform4dv",                           4, 1, 0, 0},
+        {"glProgramUniform4f",                            4, 1, 3, 1},
+        {"glProgramUniform4fv",                           4, 1, 3, 1},
+        {"glProgramUniform4i",                            4, 1, 3, 1},
+        {"glProgramUniform4iv",                           4, 1, 3, 1},
+        {"glProgramUniform4ui",                           4, 1, 3, 1},
+        {"glProgramUniform4uiv",                          4, 1, 3, 1},
+        {"glProgramUniformMatrix2dv",                     4, 1, 0, 0},
+        {"glProgramUniformMatrix2fv",                     4, 1, 3, 1},
+        {"glProgramUniformMatrix2x3dv",                   4, 1, 0, 0},
+        {"glProgramUniformMatrix2x3fv",                   4, 1, 3, 1},
+        {"glProgramUniformMatrix2x4dv",                   4, 1, 0, 0},
+        {"glProgramUniformMatrix2x4fv",                   4, 1, 3, 1},
+        {"glProgramUniformMatrix3dv",                     4, 1, 0, 0},
+        {"glProgramUniformMatrix3fv",                     4, 1, 3, 1},
+        {"glProgramUniformMatrix3x2dv",                   4, 1, 0, 0},
+        {"glProgramUniformMatrix3x2fv",                   4, 1, 3, 1},
+        {"glProgramUniformMatrix3x4dv",                   4, 1, 0, 0},
+        {"glProgramUniformMatrix3x4fv",                   4, 1, 3, 1},
+        {"glProgramUniformMatrix4dv",                     4, 1, 0, 0},
+        {"glProgramUniformMatrix4fv",                     4, 1, 3, 1},
+        {"glProgramUniformMatrix4x2dv",                   4, 1, 0, 0},
+        {"glProgramUniformMatrix4x2fv",                   4, 1, 3, 1},
+        {"glProgramUniformMatrix4x3dv",                   4, 1, 0, 0},
+        {"glProgramUniformMatrix4x3fv",                   4, 1, 3, 1},
+        {"glProvokingVertex",                             3, 2, 0, 0},
+        {"glPushDebugGroup",                              4, 3, 3, 2},
+        {"glQueryCounter",                                3, 3, 0, 0},
+        {"glReadBuffer",                                  1, 0, 3, 0},
+        {"glReadPixels",                                  1, 0, 2, 0},
+        {"glReadnPixels",                                 4, 5, 3, 2},
+        {"glReleaseShaderCompiler",                       4, 1, 2, 0},
+        {"glRenderbufferStorage",                         3, 0, 2, 0},
+        {"glRenderbufferStorageMultisample",              3, 0, 3, 0},
+        {"glResumeTransformFeedback",                     3, 3, 3, 0},
+        {"glSampleCoverage",                              1, 3, 2, 0},
+        {"glSampleMaski",                                 3, 2, 3, 1},
+        {"glSamplerParameterIiv",                         3, 3, 3, 2},
+        {"glSamplerParameterIuiv",                        3, 3, 3, 2},
+        {"glSamplerParameterf",                           3, 3, 3, 0},
+        {"glSamplerParameterfv",                          3, 3, 3, 0},
+        {"glSamplerParameteri",                           3, 3, 3, 0},
+        {"glSamplerParameteriv",                          3, 3, 3, 0},
+        {"glScissor",                                     1, 0, 2, 0},
+        {"glScissorArrayv",                               4, 1, 0, 0},
+        {"glScissorIndexed",                              4, 1, 0, 0},
+        {"glScissorIndexedv",                             4, 1, 0, 0},
+        {"glShaderBinary",                                4, 1, 2, 0},
+        {"glShaderSource",                                2, 0, 2, 0},
+        {"glShaderStorageBlockBinding",                   4, 3, 0, 0},
+        {"glSpecializeShader",                            4, 6, 0, 0},
+        {"glStencilFunc",                                 1, 0, 2, 0},
+        {"glStencilFuncSeparate",                         2, 0, 2, 0},
+        {"glStencilMask",                                 1, 0, 2, 0},
+        {"glStencilMaskSeparate",                         2, 0, 2, 0},
+        {"glStencilOp",                                   1, 0, 2, 0},
+        {"glStencilOpSeparate",                           2, 0, 2, 0},
+        {"glTexBuffer",                                   3, 1, 3, 2},
+        {"glTexBufferRange",                              4, 3, 3, 2},
+        {"glTexImage1D",                                  1, 0, 0, 0},
+        {"glTexImage2D",                                  1, 0, 2, 0},
+        {"glTexImage2DMultisample",                       3, 2, 0, 0},
+        {"glTexImage3D",                                  1, 2, 3, 0},
+        {"glTexImage3DMultisample",                       3, 2, 0, 0},
+        {"glTexParameterIiv",                             3, 0, 3, 2},
+        {"glTexParameterIuiv",                            3, 0, 3, 2},
+        {"glTexParameterf",                               1, 0, 2, 0},
+        {"glTexParameterfv",                              1, 0, 2, 0},
+        {"glTexParameteri",                               1, 0, 2, 0},
+        {"glTexParameteriv",                              1, 0, 2, 0},
+        {"glTexStorage1D",                                4, 2, 0, 0},
+        {"glTexStorage2D",                                4, 2, 3, 0},
+        {"glTexStorage2DMultisample",                     4, 3, 3, 1},
+        {"glTexStorage3D",                                4, 2, 3, 0},
+        {"glTexStorage3DMultisample",                     4, 3, 3, 2},
+        {"glTexSubImage1D",                               1, 1, 0, 0},
+        {"glTexSubImage2D",                               1, 1, 2, 0},
+        {"glTexSubImage3D",                               1, 2, 3, 0},
+        {"glTextureBarrier",                              4, 5, 0, 0},
+        {"glTextureBuffer",                               4, 5, 0, 0},
+        {"glTextureBufferRange",                          4, 5, 0, 0},
+        {"glTextureParameterIiv",                         4, 5, 0, 0},
+        {"glTextureParameterIuiv",                        4, 5, 0, 0},
+        {"glTextureParameterf",                           4, 5, 0, 0},
+        {"glTextureParameterfv",                          4, 5, 0, 0},
+        {"glTextureParameteri",                           4, 5, 0, 0},
+        {"glTextureParameteriv",                          4, 5, 0, 0},
+        {"glTextureStorage1D",                            4, 5, 0, 0},
+        {"glTextureStorage2D",                            4, 5, 0, 0},
+        {"glTextureStorage2DMultisample",                 4, 5, 0, 0},
+        {"glTextureStorage3D",                            4, 5, 0, 0},
+        {"glTextureStorage3DMultisample",                 4, 5, 0, 0},
+        {"glTextureSubImage1D",                           4, 5, 0, 0},
+        {"glTextureSubImage2D",                           4, 5, 0, 0},
+        {"glTextureSubImage3D",                           4, 5, 0, 0},
+        {"glTextureView",                                 4, 3, 0, 0},
+        {"glTransformFeedbackBufferBase",                 4, 5, 0, 0},
+        {"glTransformFeedbackBufferRange",                4, 5, 0, 0},
+        {"glTransformFeedbackVaryings",                   3, 0, 3, 0},
+        {"glUniform1d",                                   3, 3, 0, 0},
+        {"glUniform1dv",                                  3, 3, 0, 0},
+        {"glUniform1f",                                   2, 0, 2, 0},
+        {"glUniform1fv",                                  2, 0, 2, 0},
+        {"glUniform1i",                                   2, 0, 2, 0},
+        {"glUniform1iv",                                  2, 0, 2, 0},
+        {"glUniform1ui",                                  3, 0, 3, 0},
+        {"glUniform1uiv",                                 3, 0, 3, 0},
+        {"glUniform2d",                                   3, 3, 0, 0},
+        {"glUniform2dv",                                  3, 3, 0, 0},
+        {"glUniform2f",                                   2, 0, 2, 0},
+        {"glUniform2fv",                                  2, 0, 2, 0},
+        {"glUniform2i",                                   2, 0, 2, 0},
+        {"glUniform2iv",                                  2, 0, 2, 0},
+        {"glUniform2ui",                                  3, 0, 3, 0},
+        {"glUniform2uiv",                                 3, 0, 3, 0},
+        {"glUniform3d",                                   3, 3, 0, 0},
+        {"glUniform3dv",                                  3, 3, 0, 0},
+        {"glUniform3f",                                   2, 0, 2, 0},
+        {"glUniform3fv",                                  2, 0, 2, 0},
+        {"glUniform3i",                                   2, 0, 2, 0},
+        {"glUniform3iv",                                  2, 0, 2, 0},
+        {"glUniform3ui",                                  3, 0, 3, 0},
+        {"glUniform3uiv",                                 3, 0, 3, 0},
+        {"glUniform4d",                                   3, 3, 0, 0},
+        {"glUniform4dv",                                  3, 3, 0, 0},
+        {"glUniform4f",                                   2, 0, 2, 0},
+        {"glUniform4fv",                                  2, 0, 2, 0},
+        {"glUniform4i",                                   2, 0, 2, 0},
+        {"glUniform4iv",                                  2, 0, 2, 0},
+        {"glUniform4ui",                                  3, 0, 3, 0},
+        {"glUniform4uiv",                                 3, 0, 3, 0},
+        {"glUniformBlockBinding",                         3, 1, 3, 0},
+        {"glUniformMatrix2dv",                            3, 3, 0, 0},
+        {"glUniformMatrix2fv",                            2, 0, 2, 0},
+        {"glUniformMatrix2x3dv",                          3, 3, 0, 0},
+        {"glUniformMatrix2x3fv",                          2, 1, 3, 0},
+        {"glUniformMatrix2x4dv",                          3, 3, 0, 0},
+        {"glUniformMatrix2x4fv",                          2, 1, 3, 0},
+        {"glUniformMatrix3dv",                            3, 3, 0, 0},
+        {"glUniformMatrix3fv",                            2, 0, 2, 0},
+        {"glUniformMatrix3x2dv",                          3, 3, 0, 0},
+        {"glUniformMatrix3x2fv",                          2, 1, 3, 0},
+        {"glUniformMatrix3x4dv",                          3, 3, 0, 0},
+        {"glUniformMatrix3x4fv",                          2, 1, 3, 0},
+        {"glUniformMatrix4dv",                            3, 3, 0, 0},
+        {"glUniformMatrix4fv",                            2, 0, 2, 0},
+        {"glUniformMatrix4x2dv",                          3, 3, 0, 0},
+        {"glUniformMatrix4x2fv",                          2, 1, 3, 0},
+        {"glUniformMatrix4x3dv",                          3, 3, 0, 0},
+        {"glUniformMatrix4x3fv",                          2, 1, 3, 0},
+        {"glUniformSubroutinesuiv",                       3, 3, 0, 0},
+        {"glUnmapBuffer",                                 1, 5, 3, 0},
+        {"glUnmapNamedBuffer",                            4, 5, 0, 0},
+        {"glUseProgram",                                  2, 0, 2, 0},
+        {"glUseProgramStages",                            4, 1, 3, 1},
+        {"glValidateProgram",                             2, 0, 2, 0},
+        {"glValidateProgramPipeline",                     4, 1, 3, 1},
+        {"glVertexArrayAttribBinding",                    4, 5, 0, 0},
+        {"glVertexArrayAttribFormat",                     4, 5, 0, 0},
+        {"glVertexArrayAttribIFormat",                    4, 5, 0, 0},
+        {"glVertexArrayAttribLFormat",                    4, 5, 0, 0},
+        {"glVertexArrayBindingDivisor",                   4, 5, 0, 0},
+        {"glVertexArrayElementBuffer",                    4, 5, 0, 0},
+        {"glVertexArrayVertexBuffer",                     4, 5, 0, 0},
+        {"glVertexArrayVertexBuffers",                    4, 5, 0, 0},
+        {"glVertexAttrib1d",                              2, 0, 0, 0},
+        {"glVertexAttrib1dv",                             2, 0, 0, 0},
+        {"glVertexAttrib1f",                              2, 0, 2, 0},
+        {"glVertexAttrib1fv",                             2, 0, 2, 0},
+        {"glVertexAttrib1s",                              2, 0, 0, 0},
+        {"glVertexAttrib1sv",                             2, 0, 0, 0},
+        {"glVertexAttrib2d",                              2, 0, 0, 0},
+        {"glVertexAttrib2dv",                             2, 0, 0, 0},
+        {"glVertexAttrib2f",                              2, 0, 2, 0},
+        {"glVertexAttrib2fv",                             2, 0, 2, 0},
+        {"glVertexAttrib2s",                              2, 0, 0, 0},
+        {"glVertexAttrib2sv",                             2, 0, 0, 0},
+        {"glVertexAttrib3d",                              2, 0, 0, 0},
+        {"glVertexAttrib3dv",                             2, 0, 0, 0},
+        {"glVertexAttrib3f",                              2, 0, 2, 0},
+        {"glVertexAttrib3fv",                             2, 0, 2, 0},
+        {"glVertexAttrib3s",                              2, 0, 0, 0},
+        {"glVertexAttrib3sv",                             2, 0, 0, 0},
+        {"glVertexAttrib4Nbv",                            2, 0, 0, 0},
+        {"glVertexAttrib4Niv",                            2, 0, 0, 0},
+        {"glVertexAttrib4Nsv",                            2, 0, 0, 0},
+        {"glVertexAttrib4Nub",                            2, 0, 0, 0},
+        {"glVertexAttrib4Nubv",                           2, 0, 0, 0},
+        {"glVertexAttrib4Nuiv",                           2, 0, 0, 0},
+        {"glVertexAttrib4Nusv",                           2, 0, 0, 0},
+        {"glVertexAttrib4bv",                             2, 0, 0, 0},
+        {"glVertexAttrib4d",                              2, 0, 0, 0},
+        {"glVertexAttrib4dv",                             2, 0, 0, 0},
+        {"glVertexAttrib4f",                              2, 0, 2, 0},
+        {"glVertexAttrib4fv",                             2, 0, 2, 0},
+        {"glVertexAttrib4iv",                             2, 0, 0, 0},
+        {"glVertexAttrib4s",                              2, 0, 0, 0},
+        {"glVertexAttrib4sv",                             2, 0, 0, 0},
+        {"glVertexAttrib4ubv",                            2, 0, 0, 0},
+        {"glVertexAttrib4uiv",                            2, 0, 0, 0},
+        {"glVertexAttrib4usv",                            2, 0, 0, 0},
+        {"glVertexAttribBinding",                         4, 3, 3, 1},
+        {"glVertexAttribDivisor",                         3, 3, 3, 0},
+        {"glVertexAttribFormat",                          4, 3, 3, 1},
+        {"glVertexAttribI1i",                             3, 0, 0, 0},
+        {"glVertexAttribI1iv",                            3, 0, 0, 0},
+        {"glVertexAttribI1ui",                            3, 0, 0, 0},
+        {"glVertexAttribI1uiv",                           3, 0, 0, 0},
+        {"glVertexAttribI2i",                             3, 0, 0, 0},
+        {"glVertexAttribI2iv",                            3, 0, 0, 0},
+        {"glVertexAttribI2ui",                            3, 0, 0, 0},
+        {"glVertexAttribI2uiv",                           3, 0, 0, 0},
+        {"glVertexAttribI3i",                             3, 0, 0, 0},
+        {"glVertexAttribI3iv",                            3, 0, 0, 0},
+        {"glVertexAttribI3ui",                            3, 0, 0, 0},
+        {"glVertexAttribI3uiv",                           3, 0, 0, 0},
+        {"glVertexAttribI4bv",                            3, 0, 0, 0},
+        {"glVertexAttribI4i",                             3, 0, 3, 0},
+        {"glVertexAttribI4iv",                            3, 0, 3, 0},
+        {"glVertexAttribI4sv",                            3, 0, 0, 0},
+        {"glVertexAttribI4ubv",                           3, 0, 0, 0},
+        {"glVertexAttribI4ui",                            3, 0, 3, 0},
+        {"glVertexAttribI4uiv",                           3, 0, 3, 0},
+        {"glVertexAttribI4usv",                           3, 0, 0, 0},
+        {"glVertexAttribIFormat",                         4, 3, 3, 1},
+        {"glVertexAttribIPointer",                        3, 0, 3, 0},
+        {"glVertexAttribL1d",                             4, 1, 0, 0},
+        {"glVertexAttribL1dv",                            4, 1, 0, 0},
+        {"glVertexAttribL2d",                             4, 1, 0, 0},
+        {"glVertexAttribL2dv",                            4, 1, 0, 0},
+        {"glVertexAttribL3d",                             4, 1, 0, 0},
+        {"glVertexAttribL3dv",                            4, 1, 0, 0},
+        {"glVertexAttribL4d",                             4, 1, 0, 0},
+        {"glVertexAttribL4dv",                            4, 1, 0, 0},
+        {"glVertexAttribLFormat",                         4, 3, 0, 0},
+        {"glVertexAttribLPointer",                        4, 1, 0, 0},
+        {"glVertexAttribP1ui",                            3, 3, 0, 0},
+        {"glVertexAttribP1uiv",                           3, 3, 0, 0},
+        {"glVertexAttribP2ui",                            3, 3, 0, 0},
+        {"glVertexAttribP2uiv",                           3, 3, 0, 0},
+        {"glVertexAttribP3ui",                            3, 3, 0, 0},
+        {"glVertexAttribP3uiv",                           3, 3, 0, 0},
+        {"glVertexAttribP4ui",                            3, 3, 0, 0},
+        {"glVertexAttribP4uiv",                           3, 3, 0, 0},
+        {"glVertexAttribPointer",                         2, 0, 2, 0},
+        {"glVertexBindingDivisor",                        4, 3, 3, 1},
+        {"glViewport",                                    1, 0, 2, 0},
+        {"glViewportArrayv",                              4, 1, 0, 0},
+        {"glViewportIndexedf",                            4, 1, 0, 0},
+        {"glViewportIndexedfv",                           4, 1, 0, 0},
+        {"glWaitSync",                                    3, 2, 3, 0},
+    };
+
+    constexpr GLFunctionVersion const* find_function_version(std::string_view name)
+    {
+        auto iter = std::lower_bound(std::begin(GLFunctionVersions), std::end(GLFunctionVersions), name,
+            [](GLFunctionVersion const& version, std::string_view value) { return version.name < value; });
+
+        if (iter == std::end(GLFunctionVersions) || iter->name != name)
+            return nullptr;
+        return iter;
+    }
+}
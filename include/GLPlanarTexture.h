@@ -0,0 +1,58 @@
+#pragma once
+
+#include <array>
+#include <span>
+
+#include "GLColorConverter.h"
+#include "GLContext.h"
+
+namespace GL
+{
+    class GLTexture;
+
+    // one plane of a decoded frame in client memory, or an offset while a pixel unpack buffer is bound
+    struct GLPlane
+    {
+        void const*     data    = nullptr;
+        // bytes between rows, 0 for tightly packed
+        int             stride  = 0;
+    };
+
+    // owns every plane of a yuv frame as separate textures, chroma planes subsampled as the format requires.
+    // a format the context can't store leaves it without planes, check valid or is_supported
+    class GLLoader_EXPORT GLPlanarTexture
+    {
+    public:
+        GLPlanarTexture(int width, int height, YUVFormat format, GLContext* context = GLContext::current_context());
+        ~GLPlanarTexture();
+
+        GLPlanarTexture(const GLPlanarTexture&) = delete;
+        GLPlanarTexture& operator=(const GLPlanarTexture&) = delete;
+
+        // p010 needs GL_EXT_texture_norm16 on es
+        static bool is_supported(YUVFormat format, GLContext* context = GLContext::current_context());
+
+        // false when the format is not supported, plane_count is then 0 and nothing is uploaded or bound
+        [[nodiscard]] bool valid() const;
+        [[nodiscard]] int width() const;
+        [[nodiscard]] int height() const;
+        [[nodiscard]] YUVFormat format() const;
+        [[nodiscard]] int plane_count() const;
+        [[nodiscard]] GLTexture const& plane(int index) const;
+        // in the order GLColorConverter expects
+        [[nodiscard]] std::span<GLTexture const* const> planes() const;
+
+        // one entry per plane, the caller's unpack row length and alignment are restored afterwards
+        void upload(std::span<GLPlane const> planes) const;
+        // plane i goes to texture unit first_unit + i, first_unit stays the active unit
+        void bind(int first_unit = 0) const;
+        void unbind(int first_unit = 0) const;
+    private:
+        GLContext*                          m_context   = nullptr;
+        std::array<GLTexture const*, 3>     m_planes    = {};
+        int                                 m_width     = 0;
+        int                                 m_height    = 0;
+        int                                 m_count     = 0;
+        YUVFormat                           m_format;
+    };
+}
@@ -4,7 +4,16 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <gl/glcorearb.h>
 
 #include "GLContext.h"
 
@@ -13,7 +22,36 @@ namespace GL
     enum class ShaderType : uint8_t
     {
         Vertex,
-        Fragment
+        Fragment,
+        Geometry,
+        TessControl,
+        TessEvaluation,
+        // alone in its program
+        Compute
+    };
+
+    class GLProgram;
+    class GLProgramCache;
+    class GLProgramCompiler;
+
+    // a uniform resolved once at link, setting it is a compare against the last value and at most one gl call.
+    // T is bool, int32_t, uint32_t, float or a std::array of them whose size matches the glsl type, matrices are row major.
+    // the program must outlive the handle and be in use when setting
+    template<typename T>
+    class UniformHandle
+    {
+    public:
+        UniformHandle() = default;
+
+        void set(T const& value) const;
+        // false when the name was not an active uniform of a matching type and size
+        [[nodiscard]] bool valid() const { return m_program != nullptr; }
+    private:
+        friend class GLProgram;
+        UniformHandle(GLProgram const* program, int index) : m_program(program), m_index(index) {}
+    private:
+        GLProgram const*    m_program   = nullptr;
+        int                 m_index     = -1;
     };
 
     class GLLoader_EXPORT GLProgram
@@ -22,12 +60,30 @@ namespace GL
         explicit GLProgram(GLContext* context = GLContext::current_context());
         ~GLProgram();
 
+        // sources are compiled by link
         void attach_shader(ShaderType type, const char* source);
-        void link() const;
+        // loads the binary cache entry when there is one, otherwise compiles and stores the result.
+        // also collects every active uniform, relinking drops handles taken before.
+        // GLProgramCompiler links several programs without waiting for each one
+        bool link();
+        // whether the last link came from the binary cache
+        [[nodiscard]] bool is_from_binary() const;
+
+        // used by every program linked afterwards, null to always compile. the cache must outlive those links
+        static void set_binary_cache(GLProgramCache* cache);
 
         void use() const;
         void release() const;
 
+        // compute programs only, must call use method before.
+        // barriers are the glMemoryBarrier bits for how the results are read next, 0 when another dispatch
+        // or the caller issues them
+        void dispatch(uint32_t x, uint32_t y = 1, uint32_t z = 1, GLbitfield barriers = GL_ALL_BARRIER_BITS) const;
+        // enough work groups to cover width x height x depth invocations
+        void dispatch_threads(uint32_t width, uint32_t height = 1, uint32_t depth = 1, GLbitfield barriers = GL_ALL_BARRIER_BITS) const;
+        // local_size of the compute shader, zero for other programs
+        [[nodiscard]] std::array<int32_t, 3> work_group_size() const;
+
         // must call use method before set
         void set_uniform_value(const char* name, const bool& value) const;
         // must call use method before set
@@ -37,16 +93,135 @@ namespace GL
         // must call use method before set
         void set_uniform_value(const char* name, const float& v1, const float& v2) const;
         // must call use method before set
+        void set_uniform_value(const char* name, const float& v1, const float& v2, const float& v3) const;
+        // must call use method before set
         void set_uniform_value(const char* name, const float* matrix, int rows, int cols) const;
 
         void attribute_location(const char* name) const;
+
+        // cached at link, -1 when the name is not an active uniform
+        [[nodiscard]] int uniform_location(const char* name) const;
+        template<typename T>
+        [[nodiscard]] UniformHandle<T> uniform(const char* name) const;
     private:
-        GLContext*    m_context = nullptr;
-        uint32_t      m_program = 0;
-        uint32_t      m_vertex = 0;
-        uint32_t      m_fragment = 0;
+        template<typename T>
+        friend class UniformHandle;
+        friend class GLProgramCompiler;
+
+        // scalar type of the glsl declaration, samplers and images are int
+        enum class UniformBase : uint8_t
+        {
+            Float,
+            Int,
+            Uint,
+            Bool
+        };
+
+        template<typename T>
+        struct UniformElement { using type = T; };
+        template<typename T, size_t N>
+        struct UniformElement<std::array<T, N>> { using type = T; };
+
+        template<typename T>
+        static constexpr UniformBase uniform_base();
+        static UniformBase declared_base(uint32_t type);
+        // bools take any scalar type like glUniform does, everything else only its own
+        static bool accepts(UniformBase declared, UniformBase base);
+
+        struct Uniform
+        {
+            int32_t                     location    = -1;
+            uint32_t                    type        = 0;
+            UniformBase                 base        = UniformBase::Int;
+            // bytes of one element, bool is stored as int
+            uint32_t                    size        = 0;
+            // last value sent, arrays are set one element at a time
+            bool                        cached      = false;
+            std::array<uint8_t, 64>     value{};
+        };
+
+        // transparent, so lookups by const char* don't build a std::string
+        struct NameHash
+        {
+            using is_transparent = void;
+            size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+        };
+
+        using UniformIndices = std::unordered_map<std::string, int, NameHash, std::equal_to<>>;
+        using ShaderSources = std::vector<std::pair<ShaderType, std::string>>;
+
+        // link in three steps, only end_link waits for the driver.
+        // begin_link and end_link work on any context sharing with the program's one
+        void begin_link();
+        bool end_link();
+        void collect_uniforms();
+        // GL_KHR_parallel_shader_compile poll, end_link won't block once true
+        bool is_link_completed() const;
+
+        uint64_t binary_key(GLFunctions const* func) const;
+
+        int uniform_index(const char* name) const;
+        // -1 as well when the declared type doesn't accept base
+        int uniform_index(const char* name, UniformBase base, size_t size) const;
+        // skips the call when the value equals the last one sent
+        void write_uniform(int index, UniformBase base, void const* data, size_t size) const;
+    private:
+        GLContext*                      m_context = nullptr;
+        uint32_t                        m_program = 0;
+        ShaderSources                   m_sources;
+        // compiled shaders between begin_link and end_link
+        std::vector<uint32_t>           m_shaders;
+        GLProgramCache*                 m_binary_cache = nullptr;
+        uint64_t                        m_binary_key = 0;
+        bool                            m_from_binary = false;
+        std::array<int32_t, 3>          m_work_group_size{};
+        mutable std::vector<Uniform>    m_uniforms;
+        UniformIndices                  m_uniform_indices;
+
+        static std::atomic<GLProgramCache*> s_binary_cache;
     };
 
+    template<typename T>
+    void UniformHandle<T>::set(T const& value) const
+    {
+        if (m_program == nullptr)
+            return;
+
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            int32_t v = value;
+            m_program->write_uniform(m_index, GLProgram::UniformBase::Bool, &v, sizeof(v));
+        }
+        else
+            m_program->write_uniform(m_index, GLProgram::uniform_base<T>(), &value, sizeof(T));
+    }
+
+    template<typename T>
+    constexpr GLProgram::UniformBase GLProgram::uniform_base()
+    {
+        using Element = typename UniformElement<T>::type;
+        static_assert(std::is_same_v<Element, bool> || std::is_same_v<Element, int32_t> ||
+                      std::is_same_v<Element, uint32_t> || std::is_same_v<Element, float>);
+
+        if constexpr (std::is_same_v<Element, float>)
+            return UniformBase::Float;
+        else if constexpr (std::is_same_v<Element, uint32_t>)
+            return UniformBase::Uint;
+        else if constexpr (std::is_same_v<Element, bool>)
+            return UniformBase::Bool;
+        else
+            return UniformBase::Int;
+    }
+
+    template<typename T>
+    UniformHandle<T> GLProgram::uniform(const char* name) const
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        int index = uniform_index(name, uniform_base<T>(), std::is_same_v<T, bool> ? sizeof(int32_t) : sizeof(T));
+        return index < 0 ? UniformHandle<T>() : UniformHandle<T>(this, index);
+    }
+
 
 }
 
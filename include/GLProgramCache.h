@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "GLLoaderExport.h"
+
+namespace GL
+{
+    struct GLProgramBinary
+    {
+        uint32_t                    format  = 0;
+        std::span<uint8_t const>    data;
+    };
+
+    // linked program binaries persisted in one append only file, mapped read only at open.
+    // keys already hash the driver identity, so binaries of another driver are never looked up.
+    // thread safe, one file must not be opened by two caches at once
+    class GLLoader_EXPORT GLProgramCache
+    {
+    public:
+        // a missing or foreign file starts an empty cache and is rewritten on the first store
+        explicit GLProgramCache(std::filesystem::path path);
+        ~GLProgramCache();
+
+        GLProgramCache(const GLProgramCache&) = delete;
+        GLProgramCache& operator=(const GLProgramCache&) = delete;
+
+        // the span stays valid as long as the cache, storing the key again doesn't free it
+        [[nodiscard]] bool find(uint64_t key, GLProgramBinary& binary) const;
+        // appends to the file, a later entry replaces an earlier one with the same key on the next open
+        void store(uint64_t key, uint32_t format, std::span<uint8_t const> data);
+
+        [[nodiscard]] size_t size() const;
+        [[nodiscard]] std::filesystem::path const& path() const;
+
+        // FNV-1a, chain calls to hash several strings into one key
+        static uint64_t hash(std::span<uint8_t const> data, uint64_t seed = 14695981039346656037ull);
+    private:
+        void map();
+        void unmap();
+    private:
+        struct Entry
+        {
+            uint32_t                format  = 0;
+            uint8_t const*          data    = nullptr;
+            size_t                  size    = 0;
+        };
+    private:
+        std::filesystem::path                                   m_path;
+        uint8_t const*                                          m_mapping   = nullptr;
+        size_t                                                  m_mapped    = 0;
+        void*                                                   m_handle    = nullptr;
+        bool                                                    m_valid     = false;
+        std::unordered_map<uint64_t, Entry>                     m_entries;
+        // binaries stored since the file was mapped, pointing into m_blobs
+        std::unordered_map<uint64_t, Entry>                     m_stored;
+        // append only, a superseded binary stays alive for spans handed out earlier
+        std::deque<std::vector<uint8_t>>                        m_blobs;
+        mutable std::mutex                                      m_mutex;
+    };
+}
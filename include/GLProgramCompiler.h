@@ -0,0 +1,77 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "GLContext.h"
+
+namespace GL
+{
+    class GLProgram;
+
+    // links many programs at once, submit all of them before waiting on any.
+    // with GL_KHR_parallel_shader_compile the driver compiles them in parallel, otherwise worker threads do it
+    // on contexts of the share group. an unshared context without the extension links during wait.
+    // submit and wait from the thread the compiler's context is current on
+    class GLLoader_EXPORT GLProgramCompiler
+    {
+    public:
+        // a link in flight, the program must not be used or deleted before wait returns
+        class GLLoader_EXPORT Pending
+        {
+        public:
+            Pending() = default;
+            Pending(Pending&&) noexcept = default;
+            Pending& operator=(Pending&&) noexcept = default;
+            Pending(const Pending&) = delete;
+            Pending& operator=(const Pending&) = delete;
+
+            // true once wait won't block
+            [[nodiscard]] bool ready() const;
+            // finishes the link and collects the uniforms, false when it failed
+            bool wait();
+
+            [[nodiscard]] GLProgram* program() const;
+        private:
+            friend class GLProgramCompiler;
+        private:
+            GLProgram*          m_program   = nullptr;
+            // set when a worker links
+            std::future<bool>   m_result;
+            bool                m_parallel  = false;
+            bool                m_done      = false;
+            bool                m_linked    = false;
+        };
+
+        // worker contexts are only created when the driver can't compile in parallel itself,
+        // or always when driver_parallel is false
+        explicit GLProgramCompiler(size_t worker_count = 4, GLContext* context = GLContext::current_context(), bool driver_parallel = true);
+        // every submitted program must have been waited on
+        ~GLProgramCompiler();
+
+        GLProgramCompiler(const GLProgramCompiler&) = delete;
+        GLProgramCompiler& operator=(const GLProgramCompiler&) = delete;
+
+        // attach every shader first, the program must belong to the compiler's context
+        Pending submit(GLProgram* program);
+
+        // the driver compiles in parallel, no workers are used
+        [[nodiscard]] bool is_parallel() const;
+        [[nodiscard]] size_t worker_count() const;
+    private:
+        void work(GLContext* context);
+    private:
+        GLContext*                              m_context   = nullptr;
+        bool                                    m_parallel  = false;
+        std::vector<GLContext*>                 m_worker_contexts;
+        std::vector<std::thread>                m_workers;
+        std::deque<std::packaged_task<bool()>>  m_jobs;
+        bool                                    m_stop      = false;
+        std::mutex                              m_mutex;
+        std::condition_variable                 m_condition;
+    };
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+#include <gl/glcorearb.h>
+
+#include "GLContext.h"
+
+namespace GL
+{
+    // reads framebuffers into pixel pack buffers and hands finished frames back as mapped memory, without blocking the gpu.
+    // gl thread only, frame data of a persistent queue may be read on any thread but the frame is released on the gl thread
+    class GLLoader_EXPORT GLReadbackQueue
+    {
+    public:
+        // pixels of one finished readback, the buffer is recycled when the frame is released
+        class GLLoader_EXPORT Frame
+        {
+        public:
+            Frame() = default;
+            Frame(Frame&& other) noexcept;
+            Frame& operator=(Frame&& other) noexcept;
+            Frame(const Frame&) = delete;
+            Frame& operator=(const Frame&) = delete;
+            ~Frame();
+
+            // rows are bottom up, stride bytes apart
+            [[nodiscard]] std::span<uint8_t const> data() const;
+            [[nodiscard]] size_t stride() const;
+            // order of the enqueue that produced this frame
+            [[nodiscard]] uint64_t sequence() const;
+            explicit operator bool() const;
+
+            void reset();
+        private:
+            Frame(GLReadbackQueue* queue, size_t index);
+        private:
+            GLReadbackQueue*    m_queue = nullptr;
+            size_t              m_index = 0;
+
+            friend class GLReadbackQueue;
+        };
+
+        // format and type as passed to glReadPixels, depth is the number of frames in flight
+        GLReadbackQueue(int width, int height, GLenum format = GL_RGBA, GLenum type = GL_UNSIGNED_BYTE, size_t depth = 2,
+            GLContext* context = GLContext::current_context());
+        ~GLReadbackQueue();
+
+        GLReadbackQueue(const GLReadbackQueue&) = delete;
+        GLReadbackQueue& operator=(const GLReadbackQueue&) = delete;
+
+        // reads the bound read framebuffer, false when every buffer is pending or held by a frame
+        bool enqueue();
+        // oldest readback once the gpu has finished it
+        std::optional<Frame> try_dequeue();
+        // blocks until the oldest readback finishes, nullopt when nothing is pending
+        std::optional<Frame> dequeue();
+
+        [[nodiscard]] size_t pending() const;
+        [[nodiscard]] bool is_persistent() const;
+        [[nodiscard]] int width() const;
+        [[nodiscard]] int height() const;
+    private:
+        enum class BufferState : uint8_t
+        {
+            free,
+            pending,
+            held,
+        };
+
+        struct Buffer
+        {
+            GLuint          id          = 0;
+            uint8_t*        mapped      = nullptr;
+            GLsync          fence       = nullptr;
+            uint64_t        sequence    = 0;
+            BufferState     state       = BufferState::free;
+        };
+
+        std::optional<Frame> take_oldest(GLuint64 timeout);
+        void recycle(size_t index);
+    private:
+        GLContext*              m_context       = nullptr;
+        std::vector<Buffer>     m_buffers;
+        int                     m_width         = 0;
+        int                     m_height        = 0;
+        GLenum                  m_format        = GL_RGBA;
+        GLenum                  m_type          = GL_UNSIGNED_BYTE;
+        size_t                  m_stride        = 0;
+        size_t                  m_size          = 0;
+        // buffers are enqueued and completed round robin
+        size_t                  m_head          = 0;
+        size_t                  m_pending       = 0;
+        uint64_t                m_sequence      = 0;
+        bool                    m_persistent    = false;
+    };
+}
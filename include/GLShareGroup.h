@@ -0,0 +1,48 @@
+#pragma once
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+#include "GLLoaderExport.h"
+
+namespace GL
+{
+    // contexts created in the same group share objects, independent groups never serialize on each other.
+    // membership is thread safe, a group must outlive its contexts
+    class GLLoader_EXPORT GLShareGroup
+    {
+    public:
+        GLShareGroup() = default;
+        ~GLShareGroup();
+
+        GLShareGroup(const GLShareGroup&) = delete;
+        GLShareGroup& operator=(const GLShareGroup&) = delete;
+
+        [[nodiscard]] size_t size() const;
+
+        // group used by create_offscreen_context(true)
+        static GLShareGroup& default_group();
+
+        // platform layer, native handles are EGLContext / HGLRC.
+        // create receives any live member to share with (null for the first one) and returns the new native context,
+        // the group stays locked meanwhile so a member can't be destroyed while it is shared from
+        template <typename Create>
+        void* join(Create&& create);
+        void leave(void* native);
+    private:
+        mutable std::mutex  m_mutex;
+        std::vector<void*>  m_members;
+    };
+
+    template <typename Create>
+    void* GLShareGroup::join(Create&& create)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        void* native = create(m_members.empty() ? nullptr : m_members.front());
+        if (native != nullptr)
+            m_members.push_back(native);
+        return native;
+    }
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <gl/glcorearb.h>
+
+#include "GLContext.h"
+
+namespace GL
+{
+    struct GLStateCacheStats
+    {
+        // calls that reached the driver
+        uint64_t    issued  = 0;
+        // calls dropped because the state already had the value
+        uint64_t    elided  = 0;
+    };
+
+    // shadow of the binding and fixed function state of one context, drops calls that wouldn't change it.
+    // every wrapper goes through the cache of the context current on the calling thread, raw gl calls that change
+    // tracked state must be followed by invalidate. state starts unknown, so the first call of each kind always passes.
+    // objects deleted from another context of the share group may leave a stale binding here, invalidate after that too
+    class GLLoader_EXPORT GLStateCache
+    {
+    public:
+        explicit GLStateCache(GLContext const* context);
+
+        GLStateCache(const GLStateCache&) = delete;
+        GLStateCache& operator=(const GLStateCache&) = delete;
+
+        void use_program(GLuint program);
+        void bind_vertex_array(GLuint vertex_array);
+        // unit is an index, not GL_TEXTURE0 + index
+        void active_texture(GLuint unit);
+        // binds on the active unit
+        void bind_texture(GLenum target, GLuint texture);
+        void bind_texture(GLuint unit, GLenum target, GLuint texture);
+        void bind_sampler(GLuint unit, GLuint sampler);
+        // GL_FRAMEBUFFER, GL_DRAW_FRAMEBUFFER or GL_READ_FRAMEBUFFER
+        void bind_framebuffer(GLenum target, GLuint framebuffer);
+        void viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+
+        // GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE, GL_SCISSOR_TEST, GL_STENCIL_TEST are tracked, others pass through
+        void set_enabled(GLenum capability, bool enabled);
+        void blend_func(GLenum src_rgb, GLenum dst_rgb, GLenum src_alpha, GLenum dst_alpha);
+        void blend_equation(GLenum rgb, GLenum alpha);
+        void depth_func(GLenum func);
+        void depth_mask(bool mask);
+
+        // the driver resets bindings of an object deleted in this context, so must the cache
+        void texture_deleted(GLuint texture);
+        void sampler_deleted(GLuint sampler);
+        void vertex_array_deleted(GLuint vertex_array);
+        void framebuffer_deleted(GLuint framebuffer);
+        // unbinds the program when it is in use
+        void program_deleted(GLuint program);
+
+        // forget everything, the next call of each kind reaches the driver
+        void invalidate();
+
+        [[nodiscard]] GLStateCacheStats stats() const;
+
+        // cache of the context current on the calling thread. when none was made current through GLContext::activate
+        // the returned cache passes every call through to fallback's functions
+        static GLStateCache& current(GLContext const* fallback);
+    private:
+        // issues the call when value differs from the shadow, then stores it
+        template <typename T, typename Issue>
+        void apply(T& shadow, T const& value, Issue&& issue);
+    private:
+        static constexpr size_t Texture_Units = 32;
+        static constexpr size_t Texture_Targets = 4;
+        static constexpr size_t Capabilities = 5;
+
+        GLContext const*                                                    m_context   = nullptr;
+        // an untracked cache never elides
+        bool                                                                m_enabled   = true;
+        GLStateCacheStats                                                   m_stats;
+
+        GLuint                                                              m_program;
+        GLuint                                                              m_vertex_array;
+        GLuint                                                              m_active_unit;
+        std::array<std::array<GLuint, Texture_Targets>, Texture_Units>      m_textures;
+        std::array<GLuint, Texture_Units>                                   m_samplers;
+        GLuint                                                              m_draw_framebuffer;
+        GLuint                                                              m_read_framebuffer;
+        std::array<GLint, 4>                                                m_viewport;
+        std::array<uint8_t, Capabilities>                                   m_capabilities;
+        std::array<GLenum, 4>                                               m_blend_func;
+        std::array<GLenum, 2>                                               m_blend_equation;
+        GLenum                                                              m_depth_func;
+        uint8_t                                                             m_depth_mask;
+    };
+}
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <gl/glcorearb.h>
 
 #include "GLContext.h"
@@ -18,7 +19,9 @@ namespace GL
     class GLLoader_EXPORT GLTexture
     {
     public:
+        // allocates immutable storage, an unsized internal_format (GL_RGBA, GL_RED...) is promoted to its 8 bit sized format
         GLTexture(int width, int height, int internal_format, int encode_format, GLContext* context = GLContext::current_context());
+        GLTexture(int width, int height, int internal_format, int encode_format, int levels, GLContext* context = GLContext::current_context());
 #if defined(_WIN32) && defined(GL_ES)
         // shared memory with dx11, only create a texture with rgba
         GLTexture(HANDLE shared_handle, int width, int height, GLContext* context = GLContext::current_context());
@@ -30,8 +33,29 @@ namespace GL
         [[nodiscard]] int height() const;
         // nv12 yuv420 rgba, encode format, AVPixelFormat
         [[nodiscard]] int format() const;
-        // rgba rgb rg r, channel format
+        // sized channel format, GL_RGBA8 GL_R8 GL_RGBA16F...
         [[nodiscard]] int internal_format() const;
+        [[nodiscard]] int levels() const;
+        // unique for the lifetime of the process, the driver reuses ids of deleted textures
+        [[nodiscard]] uint64_t serial() const;
+        // bytes of storage across every level, an estimate as drivers may pad
+        [[nodiscard]] size_t memory_size() const;
+
+        // replaces a whole level, format and type describe data, e.g. GL_RGBA / GL_UNSIGNED_BYTE
+        void upload(void const* data, GLenum format, GLenum type, int level = 0) const;
+        // fills levels 1..levels() - 1 from level 0
+        void generate_mipmaps() const;
+        void set_filter(GLenum min_filter, GLenum mag_filter) const;
+        void set_wrap(GLenum wrap_s, GLenum wrap_t) const;
+        // binds one level for image load / store, access is GL_READ_ONLY, GL_WRITE_ONLY or GL_READ_WRITE
+        void bind_image(GLuint unit, GLenum access, int level = 0) const;
+
+        // level count of a full mip chain down to 1x1
+        static int mip_levels(int width, int height);
+        static GLenum sized_format(GLenum internal_format);
+        static size_t memory_size(int width, int height, GLenum internal_format, int levels);
+    private:
+        void allocate();
     private:
         GLContext*      m_context  = nullptr;
         GLuint          m_id       = 0;
@@ -39,5 +63,7 @@ namespace GL
         int             m_height   = 0;
         int             m_internal = 0;
         int             m_format   = 0;
+        int             m_levels   = 1;
+        uint64_t        m_serial   = 0;
     };
 }
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+#include <gl/glcorearb.h>
+
+#include "GLContext.h"
+
+namespace GL
+{
+    class GLTexture;
+
+    struct GLTexturePoolStats
+    {
+        uint64_t    hits                = 0;
+        uint64_t    misses              = 0;
+        uint64_t    evictions           = 0;
+        // storage of every texture the pool owns, in use or free
+        size_t      bytes_resident      = 0;
+        size_t      bytes_in_use        = 0;
+        size_t      peak_bytes_resident = 0;
+    };
+
+    // recycles immutable textures by (width, height, internal format, levels) instead of creating one per frame.
+    // thread safe, any thread whose current context shares objects with the pool's context may acquire and release
+    class GLLoader_EXPORT GLTexturePool
+    {
+    public:
+        // free textures are deleted least recently released first while the pool holds more than budget bytes
+        explicit GLTexturePool(size_t budget, GLContext* context = GLContext::current_context());
+        ~GLTexturePool();
+
+        GLTexturePool(const GLTexturePool&) = delete;
+        GLTexturePool& operator=(const GLTexturePool&) = delete;
+
+        // a free texture whose last use has finished on the gpu, or a new one
+        GLTexture* acquire(int width, int height, int internal_format, int levels = 1);
+        // fences the commands issued so far on the calling thread, the texture is reused once they complete
+        void release(GLTexture* texture);
+        // deletes every free texture
+        void clear();
+
+        [[nodiscard]] GLTexturePoolStats stats() const;
+        [[nodiscard]] size_t budget() const;
+    private:
+        struct Key
+        {
+            int     width;
+            int     height;
+            int     internal;
+            int     levels;
+
+            auto operator<=>(const Key&) const = default;
+        };
+
+        struct Entry
+        {
+            GLTexture*  texture;
+            GLsync      fence;
+            // release order, the smallest is evicted first
+            uint64_t    stamp;
+        };
+
+        void evict(size_t budget);
+        void destroy(Entry const& entry);
+    private:
+        GLContext*                              m_context   = nullptr;
+        // oldest release first in each bucket
+        std::map<Key, std::vector<Entry>>       m_free;
+        std::unordered_set<GLTexture*>          m_in_use;
+        GLTexturePoolStats                      m_stats;
+        size_t                                  m_budget    = 0;
+        uint64_t                                m_stamp     = 0;
+        mutable std::mutex                      m_mutex;
+    };
+}
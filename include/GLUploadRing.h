@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <gl/glcorearb.h>
+
+#include "GLContext.h"
+
+namespace GL
+{
+    class GLTexture;
+
+    // a ring of pixel unpack buffers, cpu threads fill one slot while the gpu copies earlier ones into textures.
+    // buffers stay mapped persistently when buffer storage is available, otherwise each slot is mapped unsynchronized on acquire
+    class GLLoader_EXPORT GLUploadRing
+    {
+    public:
+        struct Slot
+        {
+            size_t      index   = 0;
+            uint8_t*    data    = nullptr;
+            size_t      size    = 0;
+        };
+
+        // slot_size must hold the largest level uploaded through the ring
+        explicit GLUploadRing(size_t slot_size, size_t slot_count = 3, GLContext* context = GLContext::current_context());
+        ~GLUploadRing();
+
+        GLUploadRing(const GLUploadRing&) = delete;
+        GLUploadRing& operator=(const GLUploadRing&) = delete;
+
+        // gl thread only, blocks while the gpu still reads the next slot.
+        // slot.data may be written from any thread until the slot is uploaded
+        Slot acquire();
+        // copies the slot into a whole texture level and recycles the slot once the copy completes, gl thread only
+        void upload(Slot const& slot, GLTexture const& texture, GLenum format, GLenum type, int level = 0);
+
+        [[nodiscard]] bool is_persistent() const;
+        [[nodiscard]] size_t slot_size() const;
+        [[nodiscard]] size_t slot_count() const;
+        // acquires that had to wait for the gpu, a growing count means the ring is too short
+        [[nodiscard]] uint64_t stall_count() const;
+    private:
+        struct Buffer
+        {
+            GLuint      id          = 0;
+            uint8_t*    mapped      = nullptr;
+            GLsync      fence       = nullptr;
+            bool        acquired    = false;
+        };
+    private:
+        GLContext*              m_context       = nullptr;
+        std::vector<Buffer>     m_buffers;
+        size_t                  m_slot_size     = 0;
+        size_t                  m_next          = 0;
+        uint64_t                m_stall_count   = 0;
+        bool                    m_persistent    = false;
+    };
+}
@@ -0,0 +1,326 @@
+#include <GLColorConverter.h>
+#include <GLFramebuffer.h>
+#include <GLFunctions.h>
+#include <GLPlanarTexture.h>
+#include <GLProgram.h>
+#include <GLStateCache.h>
+#include <GLTexture.h>
+
+#include <cassert>
+#include <string>
+
+namespace GL
+{
+    static const char* VertexShader = R"(
+out vec2 v_texcoord;
+
+void main()
+{
+    v_texcoord = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    gl_Position = vec4(v_texcoord * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+    // nv12 / p010
+    static const char* SemiPlanarShader = R"(
+in vec2 v_texcoord;
+
+layout (location = 0) out vec4 frag_color;
+
+uniform sampler2D s_y;
+uniform sampler2D s_uv;
+uniform mat3 u_matrix;
+uniform vec3 u_offset;
+
+void main()
+{
+    vec3 yuv = vec3(texture(s_y, v_texcoord).r, texture(s_uv, v_texcoord).rg);
+    frag_color = vec4(clamp(u_matrix * yuv + u_offset, 0.0, 1.0), 1.0);
+}
+)";
+
+    // i420 / yuv444
+    static const char* PlanarShader = R"(
+in vec2 v_texcoord;
+
+layout (location = 0) out vec4 frag_color;
+
+uniform sampler2D s_y;
+uniform sampler2D s_u;
+uniform sampler2D s_v;
+uniform mat3 u_matrix;
+uniform vec3 u_offset;
+
+void main()
+{
+    vec3 yuv = vec3(texture(s_y, v_texcoord).r, texture(s_u, v_texcoord).r, texture(s_v, v_texcoord).r);
+    frag_color = vec4(clamp(u_matrix * yuv + u_offset, 0.0, 1.0), 1.0);
+}
+)";
+
+    // rgba to one nv12 plane, the half size uv pass lands between 2x2 source texels so linear filtering averages them
+    static const char* EncodeShader = R"(
+in vec2 v_texcoord;
+
+layout (location = 0) out vec4 frag_color;
+
+uniform sampler2D s_rgba;
+uniform mat3 u_matrix;
+uniform vec3 u_offset;
+uniform int u_chroma;
+
+void main()
+{
+    vec3 yuv = clamp(u_matrix * texture(s_rgba, v_texcoord).rgb + u_offset, 0.0, 1.0);
+    frag_color = u_chroma == 0 ? vec4(yuv.x, 0.0, 0.0, 1.0) : vec4(yuv.yz, 0.0, 1.0);
+}
+)";
+
+    // two nv12 planes and an rgba target per frame, a few frames deep
+    static constexpr size_t Framebuffer_Cache_Size = 8;
+
+    // affine transform of a color, matrix is row major
+    struct ColorTransform
+    {
+        float matrix[9];
+        float offset[3];
+    };
+
+    static void luma_coefficients(ColorSpace space, float& kr, float& kb)
+    {
+        switch (space)
+        {
+        case ColorSpace::bt601:
+            kr = 0.299f;
+            kb = 0.114f;
+            break;
+        case ColorSpace::bt2020:
+            kr = 0.2627f;
+            kb = 0.0593f;
+            break;
+        case ColorSpace::bt709:
+        default:
+            kr = 0.2126f;
+            kb = 0.0722f;
+            break;
+        }
+    }
+
+    // sample_max maps a normalized sample back to its code value, bits is the significant depth
+    static ColorTransform yuv_to_rgb(ColorSpace space, ColorRange range, float sample_max, int bits)
+    {
+        float kr, kb;
+        luma_coefficients(space, kr, kb);
+        float kg = 1.0f - kr - kb;
+
+        // Y'CbCr with y in [0, 1] and c in [-0.5, 0.5] to R'G'B'
+        const float m[9] = {
+            1.0f, 0.0f,                                 2.0f * (1.0f - kr),
+            1.0f, -2.0f * kb * (1.0f - kb) / kg,        -2.0f * kr * (1.0f - kr) / kg,
+            1.0f, 2.0f * (1.0f - kb),                   0.0f,
+        };
+
+        float step = static_cast<float>(1 << (bits - 8));
+        float y_scale, y_bias, c_scale, c_bias;
+        if (range == ColorRange::limited)
+        {
+            y_scale = sample_max / (219.0f * step);
+            y_bias = -16.0f / 219.0f;
+            c_scale = sample_max / (224.0f * step);
+            c_bias = -128.0f / 224.0f;
+        }
+        else
+        {
+            float code_max = static_cast<float>((1 << bits) - 1);
+            y_scale = sample_max / code_max;
+            y_bias = 0.0f;
+            c_scale = sample_max / code_max;
+            c_bias = -static_cast<float>(1 << (bits - 1)) / code_max;
+        }
+
+        ColorTransform transform{};
+        const float scale[3] = {y_scale, c_scale, c_scale};
+        const float bias[3] = {y_bias, c_bias, c_bias};
+        for (int row = 0; row < 3; row++)
+        {
+            for (int col = 0; col < 3; col++)
+            {
+                transform.matrix[row * 3 + col] = m[row * 3 + col] * scale[col];
+                transform.offset[row] += m[row * 3 + col] * bias[col];
+            }
+        }
+        return transform;
+    }
+
+    // R'G'B' to 8 bit normalized Y'CbCr
+    static ColorTransform rgb_to_yuv(ColorSpace space, ColorRange range)
+    {
+        float kr, kb;
+        luma_coefficients(space, kr, kb);
+        float kg = 1.0f - kr - kb;
+
+        const float m[9] = {
+            kr,                             kg,                             kb,
+            -0.5f * kr / (1.0f - kb),       -0.5f * kg / (1.0f - kb),       0.5f,
+            0.5f,                           -0.5f * kg / (1.0f - kr),       -0.5f * kb / (1.0f - kr),
+        };
+
+        float y_scale = 1.0f, c_scale = 1.0f, y_bias = 0.0f;
+        if (range == ColorRange::limited)
+        {
+            y_scale = 219.0f / 255.0f;
+            c_scale = 224.0f / 255.0f;
+            y_bias = 16.0f / 255.0f;
+        }
+
+        ColorTransform transform{};
+        const float scale[3] = {y_scale, c_scale, c_scale};
+        for (int row = 0; row < 3; row++)
+        {
+            for (int col = 0; col < 3; col++)
+                transform.matrix[row * 3 + col] = m[row * 3 + col] * scale[row];
+        }
+        transform.offset[0] = y_bias;
+        transform.offset[1] = 128.0f / 255.0f;
+        transform.offset[2] = 128.0f / 255.0f;
+        return transform;
+    }
+
+    static void set_transform(GLProgram const* program, ColorTransform const& transform)
+    {
+        program->set_uniform_value("u_matrix", transform.matrix, 3, 3);
+        program->set_uniform_value("u_offset", transform.offset[0], transform.offset[1], transform.offset[2]);
+    }
+
+
+    GLColorConverter::GLColorConverter(GLContext* context) : m_context(context)
+    {
+        auto func = m_context->get_func();
+
+        m_framebuffers = new GLFramebufferCache(Framebuffer_Cache_Size, m_context);
+        // core profiles refuse to draw without a vertex array, even an empty one
+        func->glGenVertexArrays(1, &m_vao);
+    }
+
+    GLColorConverter::~GLColorConverter()
+    {
+        delete m_semi_planar;
+        delete m_planar;
+        delete m_encode;
+
+        auto func = m_context->get_func();
+        func->glDeleteVertexArrays(1, &m_vao);
+        GLStateCache::current(m_context).vertex_array_deleted(m_vao);
+        delete m_framebuffers;
+    }
+
+    void GLColorConverter::to_rgba(YUVFormat format, std::span<GLTexture const* const> planes, GLTexture const& target,
+        ColorSpace space, ColorRange range)
+    {
+        assert(planes.size() == static_cast<size_t>(plane_count(format)));
+
+        bool planar = plane_count(format) == 3;
+        GLProgram*& program = planar ? m_planar : m_semi_planar;
+        if (program == nullptr)
+            program = create_program(planar ? PlanarShader : SemiPlanarShader);
+
+        GLStateCache& state = GLStateCache::current(m_context);
+
+        program->use();
+        if (planar)
+        {
+            program->set_uniform_value("s_y", 0);
+            program->set_uniform_value("s_u", 1);
+            program->set_uniform_value("s_v", 2);
+        }
+        else
+        {
+            program->set_uniform_value("s_y", 0);
+            program->set_uniform_value("s_uv", 1);
+        }
+
+        // p010 keeps 10 significant bits at the top of each 16 bit sample
+        if (format == YUVFormat::p010)
+            set_transform(program, yuv_to_rgb(space, range, 65535.0f / 64.0f, 10));
+        else
+            set_transform(program, yuv_to_rgb(space, range, 255.0f, 8));
+
+        for (size_t i = 0; i < planes.size(); i++)
+        {
+            state.active_texture(static_cast<GLenum>(i));
+            state.bind_texture(GL_TEXTURE_2D, planes[i]->id());
+        }
+
+        draw(target);
+
+        for (size_t i = planes.size(); i > 0; i--)
+        {
+            state.active_texture(static_cast<GLenum>(i - 1));
+            state.bind_texture(GL_TEXTURE_2D, 0);
+        }
+        program->release();
+    }
+
+    void GLColorConverter::to_rgba(GLPlanarTexture const& frame, GLTexture const& target, ColorSpace space, ColorRange range)
+    {
+        if (!frame.valid())
+            return;
+
+        to_rgba(frame.format(), frame.planes(), target, space, range);
+    }
+
+    void GLColorConverter::to_nv12(GLTexture const& source, GLTexture const& y, GLTexture const& uv, ColorSpace space, ColorRange range)
+    {
+        if (m_encode == nullptr)
+            m_encode = create_program(EncodeShader);
+
+        GLStateCache& state = GLStateCache::current(m_context);
+
+        m_encode->use();
+        m_encode->set_uniform_value("s_rgba", 0);
+        set_transform(m_encode, rgb_to_yuv(space, range));
+
+        state.active_texture(0);
+        state.bind_texture(GL_TEXTURE_2D, source.id());
+
+        m_encode->set_uniform_value("u_chroma", 0);
+        draw(y);
+        m_encode->set_uniform_value("u_chroma", 1);
+        draw(uv);
+
+        state.bind_texture(GL_TEXTURE_2D, 0);
+        m_encode->release();
+    }
+
+    int GLColorConverter::plane_count(YUVFormat format)
+    {
+        return format == YUVFormat::i420 || format == YUVFormat::yuv444 ? 3 : 2;
+    }
+
+    GLProgram* GLColorConverter::create_program(const char* fragment) const
+    {
+        std::string header = m_context->is_opengl_es() ? "#version 300 es\nprecision highp float;\n" : "#version 330\n";
+
+        auto program = new GLProgram(m_context);
+        program->attach_shader(ShaderType::Vertex, (header + VertexShader).c_str());
+        program->attach_shader(ShaderType::Fragment, (header + fragment).c_str());
+        program->link();
+        return program;
+    }
+
+    void GLColorConverter::draw(GLTexture const& target)
+    {
+        GLFramebuffer const* framebuffer = m_framebuffers->get(target);
+        if (framebuffer == nullptr)
+            return;
+
+        auto func = m_context->get_func();
+        GLStateCache& state = GLStateCache::current(m_context);
+
+        framebuffer->bind();
+        state.bind_vertex_array(m_vao);
+        func->glDrawArrays(GL_TRIANGLES, 0, 3);
+        state.bind_vertex_array(0);
+        framebuffer->unbind();
+    }
+}
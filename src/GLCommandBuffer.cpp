@@ -0,0 +1,382 @@
+#include <GLCommandBuffer.h>
+#include <GLFramebuffer.h>
+#include <GLFunctions.h>
+#include <GLReadbackQueue.h>
+#include <GLStateCache.h>
+#include <GLTexture.h>
+#include <GLVao.h>
+
+#include "platform/Utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace GL
+{
+    static constexpr size_t Chunk_Size = 64 * 1024;
+    // recycled buffers kept by a queue, beyond that they are freed
+    static constexpr size_t Max_Free_Buffers = 16;
+
+    static size_t align_up(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    GLReplayObjects::GLReplayObjects(GLContext* context) : m_context(context) {}
+
+    GLReplayObjects::~GLReplayObjects()
+    {
+        delete m_framebuffers;
+        for (auto vao : m_vaos)
+            delete vao;
+    }
+
+    GLContext* GLReplayObjects::context() const
+    {
+        return m_context;
+    }
+
+    GLFramebuffer const* GLReplayObjects::framebuffer(GLTexture const& color)
+    {
+        if (m_framebuffers == nullptr)
+            m_framebuffers = new GLFramebufferCache(16, m_context);
+        return m_framebuffers->get(color);
+    }
+
+    GLVao const* GLReplayObjects::vao(MeshType type)
+    {
+        auto index = static_cast<size_t>(type);
+        if (index >= m_vaos.size())
+            m_vaos.resize(index + 1, nullptr);
+        if (m_vaos[index] == nullptr)
+            m_vaos[index] = new GLVao(type, m_context);
+        return m_vaos[index];
+    }
+
+
+    GLCommandBuffer::GLCommandBuffer(GLCommandBuffer&& other) noexcept
+        : m_chunks(std::move(other.m_chunks)), m_current(other.m_current), m_commands(other.m_commands)
+    {
+        other.m_chunks.clear();
+        other.m_current = 0;
+        other.m_commands = 0;
+    }
+
+    GLCommandBuffer& GLCommandBuffer::operator=(GLCommandBuffer&& other) noexcept
+    {
+        if (this != &other)
+        {
+            destroy_commands();
+
+            m_chunks = std::move(other.m_chunks);
+            m_current = other.m_current;
+            m_commands = other.m_commands;
+
+            other.m_chunks.clear();
+            other.m_current = 0;
+            other.m_commands = 0;
+        }
+        return *this;
+    }
+
+    GLCommandBuffer::~GLCommandBuffer()
+    {
+        destroy_commands();
+    }
+
+    void GLCommandBuffer::use_program(GLProgram const* program)
+    {
+        record([program](GLContext*) { program->use(); });
+    }
+
+    void GLCommandBuffer::bind_texture(GLuint unit, GLTexture const* texture)
+    {
+        record([unit, texture](GLContext* context)
+        {
+            context->get_state()->bind_texture(unit, GL_TEXTURE_2D, texture != nullptr ? texture->id() : 0);
+        });
+    }
+
+    void GLCommandBuffer::bind_framebuffer(GLTexture const* color)
+    {
+        record_replay([color](GLReplayObjects& objects)
+        {
+            GLFramebuffer const* framebuffer = color != nullptr ? objects.framebuffer(*color) : nullptr;
+            if (framebuffer != nullptr)
+                framebuffer->bind();
+            else
+            {
+                error_chk(color == nullptr, "incomplete framebuffer in command buffer\n");
+                objects.context()->get_state()->bind_framebuffer(GL_FRAMEBUFFER, 0);
+            }
+        });
+    }
+
+    void GLCommandBuffer::upload(GLTexture const* texture, std::span<std::byte const> data, GLenum format, GLenum type, int level)
+    {
+        void* copy = allocate(data.size(), alignof(std::max_align_t), nullptr, nullptr);
+        std::memcpy(copy, data.data(), data.size());
+
+        record([texture, copy, format, type, level](GLContext* context)
+        {
+            // rows of the copy are tightly packed
+            auto func = context->get_func();
+            func->glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            texture->upload(copy, format, type, level);
+            func->glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        });
+    }
+
+    void GLCommandBuffer::draw(MeshType mesh)
+    {
+        record_replay([mesh](GLReplayObjects& objects)
+        {
+            GLVao const* vao = objects.vao(mesh);
+            vao->bind();
+            vao->draw();
+        });
+    }
+
+    void GLCommandBuffer::draw_arrays(GLenum mode, GLint first, GLsizei count)
+    {
+        record([mode, first, count](GLContext* context) { context->get_func()->glDrawArrays(mode, first, count); });
+    }
+
+    void GLCommandBuffer::dispatch(GLProgram const* program, uint32_t x, uint32_t y, uint32_t z, GLbitfield barriers)
+    {
+        record([program, x, y, z, barriers](GLContext*)
+        {
+            program->use();
+            program->dispatch(x, y, z, barriers);
+        });
+    }
+
+    void GLCommandBuffer::readback(GLReadbackQueue* queue)
+    {
+        record([queue](GLContext*) { queue->enqueue(); });
+    }
+
+    void GLCommandBuffer::execute(GLContext* context)
+    {
+        if (m_chunks.empty())
+            return;
+
+        GLReplayObjects objects(context);
+        execute(objects);
+    }
+
+    void GLCommandBuffer::execute(GLReplayObjects& objects)
+    {
+        if (m_chunks.empty())
+            return;
+
+        for (size_t i = 0; i <= m_current; i++)
+        {
+            Chunk& chunk = m_chunks[i];
+            size_t offset = 0;
+            while (offset < chunk.used)
+            {
+                auto command = reinterpret_cast<Command*>(chunk.data.get() + align_up(offset, alignof(Command)));
+                if (command->execute != nullptr)
+                    command->execute(reinterpret_cast<std::byte*>(command) + command->payload_offset, objects);
+
+                offset = reinterpret_cast<std::byte*>(command) - chunk.data.get() + command->size;
+            }
+        }
+    }
+
+    void GLCommandBuffer::reset()
+    {
+        destroy_commands();
+
+        for (auto& chunk : m_chunks)
+            chunk.used = 0;
+        m_current = 0;
+        m_commands = 0;
+    }
+
+    bool GLCommandBuffer::empty() const
+    {
+        return m_commands == 0;
+    }
+
+    size_t GLCommandBuffer::command_count() const
+    {
+        return m_commands;
+    }
+
+    void* GLCommandBuffer::allocate(size_t size, size_t alignment, void (*execute)(void*, GLReplayObjects&), void (*destroy)(void*))
+    {
+        // chunks come from operator new[], payloads can't ask for more than it guarantees
+        assert(alignment <= alignof(std::max_align_t));
+
+        auto place = [&](Chunk& chunk, size_t& header, size_t& payload)
+        {
+            header = align_up(chunk.used, alignof(Command));
+            payload = align_up(header + sizeof(Command), alignment);
+            return payload + size <= chunk.capacity;
+        };
+
+        size_t header = 0, payload = 0;
+        while (m_chunks.empty() || !place(m_chunks[m_current], header, payload))
+        {
+            if (!m_chunks.empty())
+                m_current++;
+
+            // an oversized command gets a chunk of its own in front of the smaller ones
+            size_t needed = sizeof(Command) + alignment + size;
+            if (m_current >= m_chunks.size() || m_chunks[m_current].capacity < needed)
+            {
+                Chunk chunk;
+                chunk.capacity = std::max(Chunk_Size, needed);
+                chunk.data = std::make_unique<std::byte[]>(chunk.capacity);
+                m_chunks.insert(m_chunks.begin() + static_cast<std::ptrdiff_t>(std::min(m_current, m_chunks.size())), std::move(chunk));
+            }
+        }
+
+        Chunk& chunk = m_chunks[m_current];
+        auto command = reinterpret_cast<Command*>(chunk.data.get() + header);
+        command->execute = execute;
+        command->destroy = destroy;
+        command->payload_offset = static_cast<uint32_t>(payload - header);
+        command->size = static_cast<uint32_t>(payload + size - header);
+        chunk.used = payload + size;
+
+        if (execute != nullptr)
+            m_commands++;
+
+        return chunk.data.get() + payload;
+    }
+
+    void GLCommandBuffer::destroy_commands()
+    {
+        if (m_chunks.empty())
+            return;
+
+        for (size_t i = 0; i <= m_current; i++)
+        {
+            Chunk& chunk = m_chunks[i];
+            size_t offset = 0;
+            while (offset < chunk.used)
+            {
+                auto command = reinterpret_cast<Command*>(chunk.data.get() + align_up(offset, alignof(Command)));
+                if (command->destroy != nullptr)
+                    command->destroy(reinterpret_cast<std::byte*>(command) + command->payload_offset);
+
+                offset = reinterpret_cast<std::byte*>(command) - chunk.data.get() + command->size;
+            }
+        }
+    }
+
+
+    GLCommandQueue::GLCommandQueue(GLShareGroup& group)
+    {
+        m_thread = std::thread(&GLCommandQueue::run, this, &group);
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this] { return m_ready; });
+    }
+
+    GLCommandQueue::~GLCommandQueue()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_one();
+        m_thread.join();
+    }
+
+    GLCommandBuffer GLCommandQueue::acquire()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_free.empty())
+            return {};
+
+        GLCommandBuffer buffer = std::move(m_free.back());
+        m_free.pop_back();
+        return buffer;
+    }
+
+    uint64_t GLCommandQueue::submit(GLCommandBuffer&& buffer)
+    {
+        uint64_t ticket;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending.push_back(std::move(buffer));
+            ticket = ++m_submitted;
+        }
+        m_condition.notify_one();
+        return ticket;
+    }
+
+    void GLCommandQueue::wait(uint64_t ticket)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this, ticket] { return m_completed >= ticket; });
+    }
+
+    void GLCommandQueue::wait_idle()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this] { return m_completed == m_submitted; });
+    }
+
+    GLContext* GLCommandQueue::context() const
+    {
+        return m_context;
+    }
+
+    void GLCommandQueue::run(GLShareGroup* group)
+    {
+        GLContext* context = create_offscreen_context(*group);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_context = context;
+            m_ready = true;
+        }
+        m_done.notify_all();
+
+        // kept across buffers, so each target texture is validated once
+        GLReplayObjects* objects = context != nullptr ? new GLReplayObjects(context) : nullptr;
+
+        while (true)
+        {
+            GLCommandBuffer buffer;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this] { return m_stop || !m_pending.empty(); });
+                if (m_pending.empty())
+                    break;
+
+                buffer = std::move(m_pending.front());
+                m_pending.pop_front();
+            }
+
+            // without a context the buffer is dropped, waiters must not hang
+            if (context != nullptr)
+            {
+                buffer.execute(*objects);
+                // make the results visible to the other contexts of the group
+                context->get_func()->glFlush();
+            }
+            buffer.reset();
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_free.size() < Max_Free_Buffers)
+                    m_free.push_back(std::move(buffer));
+                m_completed++;
+            }
+            m_done.notify_all();
+        }
+
+        if (context != nullptr)
+        {
+            delete objects;
+            context->release();
+            destroy_context(context);
+        }
+    }
+}
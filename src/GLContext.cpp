@@ -4,24 +4,61 @@
 
 
 #include <GLContext.h>
+#include <GLDevice.h>
 #include <GLFunctions.h>
 #include <GLExtFunctions.h>
+#include <GLShareGroup.h>
+#include <GLStateCache.h>
 
 #include "platform/PlatformGLContext.h"
+#include "platform/Utils.h"
+
+#include <atomic>
 
 namespace GL
 {
-    static thread_local GLContext* t_context = nullptr;
+    // tracks make-current done through activate / release, raw egl / wgl calls bypass it
+    static thread_local GLContext const* t_context = nullptr;
+    static std::atomic<uint64_t> s_switch_count = 0;
 
-    GLContext::GLContext(bool shared) : m_is_shared(shared) {}
+    GLContext::GLContext(GLShareGroup* share_group) : m_share_group(share_group), m_state(new GLStateCache(this)) {}
 
     GLContext::~GLContext()
     {
-        delete m_func;
-        m_func = nullptr;
+        // the platform destructor has already unbound it
+        if (t_context == this)
+            t_context = nullptr;
 
-        delete m_ext_func;
+        m_func = nullptr;
         m_ext_func = nullptr;
+        m_extensions = nullptr;
+
+        delete m_state;
+        m_state = nullptr;
+    }
+
+    bool GLContext::activate() const
+    {
+        if (t_context == this)
+            return true;
+
+        s_switch_count.fetch_add(1, std::memory_order_relaxed);
+        if (!make_current())
+            return false;
+
+        t_context = this;
+        return true;
+    }
+
+    bool GLContext::release() const
+    {
+        if (t_context == nullptr)
+            return true;
+
+        s_switch_count.fetch_add(1, std::memory_order_relaxed);
+        // whatever was current is unbound either way
+        t_context = nullptr;
+        return clear_current();
     }
 
     GLFunctions const* GLContext::get_func() const
@@ -34,26 +71,87 @@ namespace GL
         return m_ext_func;
     }
 
+    GLStateCache* GLContext::get_state() const
+    {
+        return m_state;
+    }
+
     bool GLContext::is_shared() const
     {
-        return m_is_shared;
+        return m_share_group != nullptr;
+    }
+
+    GLShareGroup* GLContext::share_group() const
+    {
+        return m_share_group;
+    }
+
+    bool GLContext::version(int* major, int* minor) const
+    {
+        return query_version(m_func, major, minor);
+    }
+
+    bool GLContext::has_extension(std::string_view name) const
+    {
+        return m_extensions != nullptr && m_extensions->contains(name);
     }
 
     GLContext* GLContext::current_context()
     {
-        return t_context;
+        return const_cast<GLContext*>(t_context);
     }
 
+    uint64_t GLContext::switch_count()
+    {
+        return s_switch_count.load(std::memory_order_relaxed);
+    }
 
-    GLContext* create_offscreen_context(bool shared)
+
+    void set_lazy_function_loading(bool lazy)
+    {
+        set_lazy_loading(lazy);
+    }
+
+    static GLContext* create_offscreen_context(GLShareGroup* group)
     {
         GLContext* context = nullptr;
 #if defined(_WIN32) && !defined(GL_ES)
-        context = create_wgl_offscreen_context(shared);
+        context = create_wgl_offscreen_context(group);
 #else
-        context = create_egl_offscreen_context(shared);
+        context = create_egl_offscreen_context(group);
+#endif
+        if (context != nullptr)
+            context->activate();
+        return context;
+    }
+
+    GLContext* create_offscreen_context(bool shared)
+    {
+        return create_offscreen_context(shared ? &GLShareGroup::default_group() : nullptr);
+    }
+
+    GLContext* create_offscreen_context(GLShareGroup& group)
+    {
+        return create_offscreen_context(&group);
+    }
+
+    std::vector<GLDevice> enumerate_devices()
+    {
+#if defined(_WIN32) && !defined(GL_ES)
+        return {};
+#else
+        return enumerate_egl_devices();
+#endif
+    }
+
+    GLContext* create_offscreen_context(GLDevice const& device, GLShareGroup* group)
+    {
+        GLContext* context = nullptr;
+#if !defined(_WIN32) || defined(GL_ES)
+        context = create_egl_offscreen_context(group, device.index);
 #endif
-        t_context = context;
+        if (context != nullptr)
+            context->activate();
         return context;
     }
 
@@ -0,0 +1,197 @@
+#include <GLContextPool.h>
+#include <GLFunctions.h>
+#include <GLStateCache.h>
+
+#include <algorithm>
+#include <cassert>
+
+namespace GL
+{
+    // unbind everything a job may have left bound so the next lease starts clean
+    static void reset_context_state(GLContext const* context)
+    {
+        auto func = context->get_func();
+        GLStateCache& state = *context->get_state();
+
+        state.bind_framebuffer(GL_FRAMEBUFFER, 0);
+        state.bind_vertex_array(0);
+        state.use_program(0);
+        func->glBindBuffer(GL_ARRAY_BUFFER, 0);
+        // pixel buffers need es 3.0 or gl 2.1, es 2.0 rejects the targets
+        int major = 0, minor = 0;
+        if (context->version(&major, &minor) && (context->is_opengl_es() ? major >= 3 : major > 2 || (major == 2 && minor >= 1)))
+        {
+            func->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+            func->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        }
+        state.active_texture(0);
+        state.bind_texture(GL_TEXTURE_2D, 0);
+        // make the job's commands visible to other contexts in the share group
+        func->glFlush();
+    }
+
+    GLContextPool::Lease::Lease(GLContextPool* pool, GLContext* context) : m_pool(pool), m_context(context) {}
+
+    GLContextPool::Lease::Lease(Lease&& other) noexcept : m_pool(other.m_pool), m_context(other.m_context)
+    {
+        other.m_pool = nullptr;
+        other.m_context = nullptr;
+    }
+
+    GLContextPool::Lease& GLContextPool::Lease::operator=(Lease&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+
+            m_pool = other.m_pool;
+            m_context = other.m_context;
+            other.m_pool = nullptr;
+            other.m_context = nullptr;
+        }
+        return *this;
+    }
+
+    GLContextPool::Lease::~Lease()
+    {
+        reset();
+    }
+
+    GLContext* GLContextPool::Lease::context() const
+    {
+        return m_context;
+    }
+
+    GLContext* GLContextPool::Lease::operator->() const
+    {
+        return m_context;
+    }
+
+    GLContextPool::Lease::operator bool() const
+    {
+        return m_context != nullptr;
+    }
+
+    void GLContextPool::Lease::reset()
+    {
+        if (m_context != nullptr)
+        {
+            reset_context_state(m_context);
+            m_context->release();
+            m_pool->give_back(m_context);
+
+            m_pool = nullptr;
+            m_context = nullptr;
+        }
+    }
+
+
+    GLContextPool::GLContextPool(size_t count, GLShareGroup& group)
+    {
+        // creating a context makes it current, the caller gets its own one back afterwards
+        GLContext* previous = GLContext::current_context();
+
+        m_contexts.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            GLContext* context = create_offscreen_context(group);
+            if (context == nullptr)
+                break;
+
+            // a context current here couldn't be made current by the leasing thread
+            context->release();
+            m_contexts.push_back(context);
+        }
+
+        if (previous != nullptr)
+            previous->activate();
+
+        m_free = m_contexts;
+        m_stats.capacity = m_contexts.size();
+    }
+
+    GLContextPool::~GLContextPool()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // every lease must be returned before the pool is destroyed
+        assert(m_free.size() == m_contexts.size());
+
+        for (auto context : m_contexts)
+            destroy_context(context);
+
+        m_contexts.clear();
+        m_free.clear();
+    }
+
+    GLContextPool::Lease GLContextPool::acquire()
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        GLContext* context = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this] { return !m_free.empty() || m_contexts.empty(); });
+            if (m_free.empty())
+                return {};
+
+            context = m_free.back();
+            m_free.pop_back();
+        }
+
+        return lease(context, start);
+    }
+
+    std::optional<GLContextPool::Lease> GLContextPool::try_acquire()
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        GLContext* context = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_free.empty())
+                return std::nullopt;
+
+            context = m_free.back();
+            m_free.pop_back();
+        }
+
+        return lease(context, start);
+    }
+
+    GLContextPoolStats GLContextPool::stats() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stats;
+    }
+
+    size_t GLContextPool::capacity() const
+    {
+        return m_contexts.size();
+    }
+
+    GLContextPool::Lease GLContextPool::lease(GLContext* context, std::chrono::steady_clock::time_point start)
+    {
+        auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stats.in_use++;
+            m_stats.peak_in_use = std::max(m_stats.peak_in_use, m_stats.in_use);
+            m_stats.acquire_count++;
+            m_stats.total_acquire_latency += latency;
+            m_stats.max_acquire_latency = std::max(m_stats.max_acquire_latency, latency);
+        }
+
+        context->activate();
+        return {this, context};
+    }
+
+    void GLContextPool::give_back(GLContext* context)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_free.push_back(context);
+            m_stats.in_use--;
+        }
+        m_condition.notify_one();
+    }
+}
@@ -0,0 +1,203 @@
+#include <GLFence.h>
+#include <GLFunctions.h>
+
+#include "platform/Utils.h"
+
+#include <utility>
+
+namespace GL
+{
+    GLFence::GLFence(GLContext* context) : m_context(context)
+    {
+        m_sync = m_context->get_func()->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    GLFence::GLFence(GLsync sync, GLContext* context) : m_context(context), m_sync(sync)
+    {
+
+    }
+
+    GLFence::~GLFence()
+    {
+        if (m_sync != nullptr)
+            m_context->get_func()->glDeleteSync(m_sync);
+    }
+
+    GLFence::GLFence(GLFence&& other) noexcept
+        : m_context(other.m_context), m_sync(std::exchange(other.m_sync, nullptr))
+    {
+
+    }
+
+    GLFence& GLFence::operator=(GLFence&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (m_sync != nullptr)
+                m_context->get_func()->glDeleteSync(m_sync);
+
+            m_context = other.m_context;
+            m_sync = std::exchange(other.m_sync, nullptr);
+        }
+        return *this;
+    }
+
+    FenceStatus GLFence::client_wait(GLuint64 timeout) const
+    {
+        if (m_sync == nullptr)
+            return FenceStatus::failed;
+
+        switch (m_context->get_func()->glClientWaitSync(m_sync, GL_SYNC_FLUSH_COMMANDS_BIT, timeout))
+        {
+        case GL_ALREADY_SIGNALED:
+        case GL_CONDITION_SATISFIED:
+            return FenceStatus::signaled;
+        case GL_TIMEOUT_EXPIRED:
+            return FenceStatus::timeout;
+        default:
+            return FenceStatus::failed;
+        }
+    }
+
+    void GLFence::server_wait() const
+    {
+        if (m_sync != nullptr)
+            m_context->get_func()->glWaitSync(m_sync, 0, GL_TIMEOUT_IGNORED);
+    }
+
+    bool GLFence::is_signaled() const
+    {
+        if (m_sync == nullptr)
+            return false;
+
+        GLint status = GL_UNSIGNALED;
+        m_context->get_func()->glGetSynciv(m_sync, GL_SYNC_STATUS, 1, nullptr, &status);
+        return status == GL_SIGNALED;
+    }
+
+    GLsync GLFence::get() const
+    {
+        return m_sync;
+    }
+
+    GLsync GLFence::release()
+    {
+        return std::exchange(m_sync, nullptr);
+    }
+
+    GLFence::operator bool() const
+    {
+        return m_sync != nullptr;
+    }
+
+
+    GLFenceWatcher::GLFenceWatcher(GLShareGroup& group, GLuint64 poll_interval) : m_poll_interval(poll_interval)
+    {
+        m_thread = std::thread(&GLFenceWatcher::run, this, &group);
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this] { return m_ready; });
+    }
+
+    GLFenceWatcher::~GLFenceWatcher()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_all();
+        m_thread.join();
+    }
+
+    bool GLFenceWatcher::valid() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_valid;
+    }
+
+    bool GLFenceWatcher::on_signaled(GLFence&& fence, std::function<void()> callback)
+    {
+        // the callback would otherwise run before the gpu is done with its resources
+        if (!error_chk(valid(), "fence watcher has no context\n"))
+            return false;
+
+        GLContext* context = GLContext::current_context();
+        if (context != nullptr)
+            context->get_func()->glFlush();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_incoming.push_back({std::move(fence), std::move(callback)});
+            m_pending++;
+        }
+        m_condition.notify_all();
+        return true;
+    }
+
+    size_t GLFenceWatcher::pending() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pending;
+    }
+
+    void GLFenceWatcher::run(GLShareGroup* group)
+    {
+        GLContext* context = create_offscreen_context(*group);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_valid = context != nullptr;
+            m_ready = true;
+        }
+        m_condition.notify_all();
+
+        // on_signaled refuses every fence, there is nothing to poll
+        if (context == nullptr)
+            return;
+
+        // both lists keep their storage, handing fences over allocates nothing once warm
+        std::vector<Watch> watching;
+        std::vector<Watch> incoming;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                // nothing to poll, sleep until a fence arrives
+                if (watching.empty())
+                    m_condition.wait(lock, [this] { return m_stop || !m_incoming.empty(); });
+
+                if (m_stop && watching.empty() && m_incoming.empty())
+                    break;
+
+                std::swap(incoming, m_incoming);
+            }
+
+            for (auto& watch : incoming)
+                watching.push_back(std::move(watch));
+            incoming.clear();
+
+            size_t signaled = 0;
+            std::erase_if(watching, [&](Watch& watch)
+            {
+                if (watch.fence.client_wait(0) == FenceStatus::timeout)
+                    return false;
+
+                watch.callback();
+                signaled++;
+                return true;
+            });
+
+            if (signaled > 0)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_pending -= signaled;
+            }
+
+            // fences of one context signal in order, wait in the driver on the oldest rather than sleeping
+            if (!watching.empty())
+                watching.front().fence.client_wait(m_poll_interval);
+        }
+
+        context->release();
+        destroy_context(context);
+    }
+}
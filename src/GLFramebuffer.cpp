@@ -0,0 +1,225 @@
+#include <GLFramebuffer.h>
+#include <GLFunctions.h>
+#include <GLStateCache.h>
+#include <GLTexture.h>
+
+#include <algorithm>
+#include <cassert>
+
+namespace GL
+{
+    GLFramebuffer::GLFramebuffer(GLContext* context) : m_context(context)
+    {
+        m_context->get_func()->glGenFramebuffers(1, &m_id);
+    }
+
+    GLFramebuffer::~GLFramebuffer()
+    {
+        m_context->get_func()->glDeleteFramebuffers(1, &m_id);
+        GLStateCache::current(m_context).framebuffer_deleted(m_id);
+    }
+
+    void GLFramebuffer::attach_color(int index, GLTexture const& texture, int level)
+    {
+        auto func = m_context->get_func();
+        GLStateCache& state = GLStateCache::current(m_context);
+
+        GLenum attachment = GL_COLOR_ATTACHMENT0 + index;
+        state.bind_framebuffer(GL_FRAMEBUFFER, m_id);
+        func->glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, texture.id(), level);
+        state.bind_framebuffer(GL_FRAMEBUFFER, 0);
+
+        if (m_draw_buffers.size() <= static_cast<size_t>(index))
+            m_draw_buffers.resize(index + 1, GL_NONE);
+        m_draw_buffers[index] = attachment;
+
+        fit(texture, level);
+        m_complete = false;
+    }
+
+    void GLFramebuffer::attach_depth(GLTexture const& texture)
+    {
+        auto func = m_context->get_func();
+        GLStateCache& state = GLStateCache::current(m_context);
+
+        GLenum format = static_cast<GLenum>(texture.internal_format());
+        GLenum attachment = format == GL_DEPTH24_STENCIL8 || format == GL_DEPTH32F_STENCIL8 ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+
+        state.bind_framebuffer(GL_FRAMEBUFFER, m_id);
+        func->glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, texture.id(), 0);
+        state.bind_framebuffer(GL_FRAMEBUFFER, 0);
+
+        fit(texture, 0);
+        m_complete = false;
+    }
+
+    bool GLFramebuffer::validate()
+    {
+        auto func = m_context->get_func();
+        GLStateCache& state = GLStateCache::current(m_context);
+
+        state.bind_framebuffer(GL_FRAMEBUFFER, m_id);
+        // draw buffers are framebuffer state, set once here rather than on every bind.
+        // es 2.0 has no glDrawBuffers and always draws to attachment 0
+        if (func->glDrawBuffers != nullptr)
+        {
+            if (m_draw_buffers.empty())
+            {
+                GLenum none = GL_NONE;
+                func->glDrawBuffers(1, &none);
+            }
+            else
+                func->glDrawBuffers(static_cast<GLsizei>(m_draw_buffers.size()), m_draw_buffers.data());
+        }
+
+        m_complete = func->glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+        state.bind_framebuffer(GL_FRAMEBUFFER, 0);
+
+        return m_complete;
+    }
+
+    void GLFramebuffer::bind() const
+    {
+        GLStateCache& state = GLStateCache::current(m_context);
+
+        state.bind_framebuffer(GL_FRAMEBUFFER, m_id);
+        state.viewport(0, 0, m_width, m_height);
+    }
+
+    void GLFramebuffer::unbind() const
+    {
+        GLStateCache::current(m_context).bind_framebuffer(GL_FRAMEBUFFER, 0);
+    }
+
+    GLuint GLFramebuffer::id() const
+    {
+        return m_id;
+    }
+
+    bool GLFramebuffer::is_complete() const
+    {
+        return m_complete;
+    }
+
+    int GLFramebuffer::width() const
+    {
+        return m_width;
+    }
+
+    int GLFramebuffer::height() const
+    {
+        return m_height;
+    }
+
+    void GLFramebuffer::fit(GLTexture const& texture, int level)
+    {
+        int width = std::max(texture.width() >> level, 1);
+        int height = std::max(texture.height() >> level, 1);
+
+        bool first = m_width == 0 && m_height == 0;
+        m_width = first ? width : std::min(m_width, width);
+        m_height = first ? height : std::min(m_height, height);
+    }
+
+
+    GLFramebufferCache::GLFramebufferCache(size_t capacity, GLContext* context)
+        : m_context(context), m_capacity(std::max<size_t>(capacity, 1)) {}
+
+    GLFramebufferCache::~GLFramebufferCache()
+    {
+        clear();
+    }
+
+    GLFramebuffer const* GLFramebufferCache::get(std::span<GLTexture const* const> colors, GLTexture const* depth)
+    {
+        uint64_t depth_serial = depth != nullptr ? depth->serial() : 0;
+
+        auto same = [&](Entry const& entry)
+        {
+            return entry.depth == depth_serial && std::equal(entry.colors.begin(), entry.colors.end(), colors.begin(), colors.end(),
+                [](uint64_t serial, GLTexture const* texture) { return serial == texture->serial(); });
+        };
+
+        auto iter = std::find_if(m_entries.begin(), m_entries.end(), same);
+        if (iter != m_entries.end())
+        {
+            iter->stamp = ++m_stamp;
+            m_hits++;
+            return iter->framebuffer;
+        }
+
+        m_misses++;
+
+        auto framebuffer = new GLFramebuffer(m_context);
+        for (size_t i = 0; i < colors.size(); i++)
+            framebuffer->attach_color(static_cast<int>(i), *colors[i]);
+        if (depth != nullptr)
+            framebuffer->attach_depth(*depth);
+
+        if (!framebuffer->validate())
+        {
+            delete framebuffer;
+            return nullptr;
+        }
+
+        if (m_entries.size() >= m_capacity)
+        {
+            auto oldest = std::min_element(m_entries.begin(), m_entries.end(),
+                [](Entry const& a, Entry const& b) { return a.stamp < b.stamp; });
+            delete oldest->framebuffer;
+            m_entries.erase(oldest);
+        }
+
+        Entry entry;
+        entry.colors.reserve(colors.size());
+        for (auto color : colors)
+            entry.colors.push_back(color->serial());
+        entry.depth = depth_serial;
+        entry.framebuffer = framebuffer;
+        entry.stamp = ++m_stamp;
+        m_entries.push_back(std::move(entry));
+
+        return framebuffer;
+    }
+
+    GLFramebuffer const* GLFramebufferCache::get(GLTexture const& color)
+    {
+        GLTexture const* colors[] = {&color};
+        return get(colors);
+    }
+
+    void GLFramebufferCache::evict(GLTexture const& texture)
+    {
+        uint64_t serial = texture.serial();
+
+        std::erase_if(m_entries, [serial](Entry const& entry)
+        {
+            bool attached = entry.depth == serial || std::find(entry.colors.begin(), entry.colors.end(), serial) != entry.colors.end();
+            if (attached)
+                delete entry.framebuffer;
+            return attached;
+        });
+    }
+
+    void GLFramebufferCache::clear()
+    {
+        for (auto& entry : m_entries)
+            delete entry.framebuffer;
+        m_entries.clear();
+    }
+
+    size_t GLFramebufferCache::size() const
+    {
+        return m_entries.size();
+    }
+
+    uint64_t GLFramebufferCache::hit_count() const
+    {
+        return m_hits;
+    }
+
+    uint64_t GLFramebufferCache::miss_count() const
+    {
+        return m_misses;
+    }
+}
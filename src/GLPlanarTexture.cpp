@@ -0,0 +1,175 @@
+#include <GLFunctions.h>
+#include <GLPlanarTexture.h>
+#include <GLStateCache.h>
+#include <GLTexture.h>
+
+#include <cassert>
+#include <cstdint>
+
+namespace GL
+{
+    struct PlaneLayout
+    {
+        GLenum      internal;
+        GLenum      format;
+        GLenum      type;
+        // bytes per texel
+        int         size;
+        bool        subsampled;
+    };
+
+    static PlaneLayout plane_layout(YUVFormat format, int index)
+    {
+        switch (format)
+        {
+        case YUVFormat::nv12:
+            return index == 0 ? PlaneLayout{GL_R8, GL_RED, GL_UNSIGNED_BYTE, 1, false} : PlaneLayout{GL_RG8, GL_RG, GL_UNSIGNED_BYTE, 2, true};
+        case YUVFormat::p010:
+            return index == 0 ? PlaneLayout{GL_R16, GL_RED, GL_UNSIGNED_SHORT, 2, false} : PlaneLayout{GL_RG16, GL_RG, GL_UNSIGNED_SHORT, 4, true};
+        case YUVFormat::i420:
+            return PlaneLayout{GL_R8, GL_RED, GL_UNSIGNED_BYTE, 1, index != 0};
+        case YUVFormat::yuv444:
+        default:
+            return PlaneLayout{GL_R8, GL_RED, GL_UNSIGNED_BYTE, 1, false};
+        }
+    }
+
+    GLPlanarTexture::GLPlanarTexture(int width, int height, YUVFormat format, GLContext* context)
+        : m_context(context), m_width(width), m_height(height), m_format(format)
+    {
+        if (!is_supported(format, context))
+            return;
+
+        m_count = GLColorConverter::plane_count(format);
+        for (int i = 0; i < m_count; i++)
+        {
+            PlaneLayout layout = plane_layout(m_format, i);
+            int plane_width = layout.subsampled ? (m_width + 1) / 2 : m_width;
+            int plane_height = layout.subsampled ? (m_height + 1) / 2 : m_height;
+
+            m_planes[i] = new GLTexture(plane_width, plane_height, static_cast<int>(layout.internal), static_cast<int>(layout.format), m_context);
+        }
+    }
+
+    GLPlanarTexture::~GLPlanarTexture()
+    {
+        for (int i = 0; i < m_count; i++)
+            delete m_planes[i];
+    }
+
+    bool GLPlanarTexture::is_supported(YUVFormat format, GLContext* context)
+    {
+        // R16 / RG16 are core on desktop gl but an extension on es, integer formats can't be sampled linearly
+        if (format == YUVFormat::p010 && context->is_opengl_es())
+            return context->has_extension("GL_EXT_texture_norm16");
+        return true;
+    }
+
+    bool GLPlanarTexture::valid() const
+    {
+        return m_count != 0;
+    }
+
+    int GLPlanarTexture::width() const
+    {
+        return m_width;
+    }
+
+    int GLPlanarTexture::height() const
+    {
+        return m_height;
+    }
+
+    YUVFormat GLPlanarTexture::format() const
+    {
+        return m_format;
+    }
+
+    int GLPlanarTexture::plane_count() const
+    {
+        return m_count;
+    }
+
+    GLTexture const& GLPlanarTexture::plane(int index) const
+    {
+        assert(index >= 0 && index < m_count);
+        return *m_planes[index];
+    }
+
+    std::span<GLTexture const* const> GLPlanarTexture::planes() const
+    {
+        return {m_planes.data(), static_cast<size_t>(m_count)};
+    }
+
+    void GLPlanarTexture::upload(std::span<GLPlane const> planes) const
+    {
+        if (!valid())
+            return;
+
+        assert(planes.size() == static_cast<size_t>(m_count));
+        auto func = m_context->get_func();
+        GLStateCache& state = GLStateCache::current(m_context);
+
+        // row length needs es 3.0 or GL_EXT_unpack_subimage, without it strided planes go up row by row
+        int major = 0, minor = 0;
+        bool row_length = !m_context->is_opengl_es() || (m_context->version(&major, &minor) && major >= 3) ||
+                          m_context->has_extension("GL_EXT_unpack_subimage");
+
+        GLint alignment = 4, length = 0;
+        func->glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+        if (row_length)
+            func->glGetIntegerv(GL_UNPACK_ROW_LENGTH, &length);
+
+        // strides are arbitrary bytes, row length carries them in texels
+        func->glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        for (int i = 0; i < m_count; i++)
+        {
+            PlaneLayout layout = plane_layout(m_format, i);
+            GLTexture const* texture = m_planes[i];
+            int stride = planes[i].stride;
+
+            assert(stride % layout.size == 0);
+            state.bind_texture(GL_TEXTURE_2D, texture->id());
+            if (row_length)
+            {
+                func->glPixelStorei(GL_UNPACK_ROW_LENGTH, stride / layout.size);
+                func->glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, texture->width(), texture->height(), layout.format, layout.type, planes[i].data);
+            }
+            else if (stride == 0 || stride == texture->width() * layout.size)
+                func->glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, texture->width(), texture->height(), layout.format, layout.type, planes[i].data);
+            else
+            {
+                // also valid as offsets into a bound unpack buffer
+                auto row = static_cast<uint8_t const*>(planes[i].data);
+                for (int y = 0; y < texture->height(); y++)
+                    func->glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y, texture->width(), 1, layout.format, layout.type, row + static_cast<size_t>(y) * stride);
+            }
+        }
+        state.bind_texture(GL_TEXTURE_2D, 0);
+        if (row_length)
+            func->glPixelStorei(GL_UNPACK_ROW_LENGTH, length);
+        func->glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+    }
+
+    void GLPlanarTexture::bind(int first_unit) const
+    {
+        GLStateCache& state = GLStateCache::current(m_context);
+
+        for (int i = m_count - 1; i >= 0; i--)
+        {
+            state.active_texture(first_unit + i);
+            state.bind_texture(GL_TEXTURE_2D, m_planes[i]->id());
+        }
+    }
+
+    void GLPlanarTexture::unbind(int first_unit) const
+    {
+        GLStateCache& state = GLStateCache::current(m_context);
+
+        for (int i = m_count - 1; i >= 0; i--)
+        {
+            state.active_texture(first_unit + i);
+            state.bind_texture(GL_TEXTURE_2D, 0);
+        }
+    }
+}
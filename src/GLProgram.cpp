@@ -4,6 +4,14 @@
 
 #include "GLProgram.h"
 #include "GLFunctions.h"
+#include "GLProgramCache.h"
+#include "GLStateCache.h"
+
+#include "platform/Utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
 
 namespace GL
 {
@@ -45,6 +53,94 @@ namespace GL
         return true;
     }
 
+    // bytes of one element as the cache stores it, samplers and images are set as int
+    static size_t uniform_size(GLenum type)
+    {
+        switch (type)
+        {
+        case GL_FLOAT: case GL_INT: case GL_UNSIGNED_INT: case GL_BOOL:
+            return 4;
+        case GL_FLOAT_VEC2: case GL_INT_VEC2: case GL_UNSIGNED_INT_VEC2: case GL_BOOL_VEC2:
+            return 8;
+        case GL_FLOAT_VEC3: case GL_INT_VEC3: case GL_UNSIGNED_INT_VEC3: case GL_BOOL_VEC3:
+            return 12;
+        case GL_FLOAT_VEC4: case GL_INT_VEC4: case GL_UNSIGNED_INT_VEC4: case GL_BOOL_VEC4: case GL_FLOAT_MAT2:
+            return 16;
+        case GL_FLOAT_MAT2x3: case GL_FLOAT_MAT3x2:
+            return 24;
+        case GL_FLOAT_MAT2x4: case GL_FLOAT_MAT4x2:
+            return 32;
+        case GL_FLOAT_MAT3:
+            return 36;
+        case GL_FLOAT_MAT3x4: case GL_FLOAT_MAT4x3:
+            return 48;
+        case GL_FLOAT_MAT4:
+            return 64;
+        default:
+            return 4;
+        }
+    }
+
+    // matrices are row major like the rest of the class
+    static void send_uniform(GLFunctions const* func, GLenum type, GLint location, void const* data)
+    {
+        auto f = static_cast<GLfloat const*>(data);
+        auto i = static_cast<GLint const*>(data);
+        auto u = static_cast<GLuint const*>(data);
+
+        switch (type)
+        {
+        case GL_FLOAT:              func->glUniform1fv(location, 1, f); break;
+        case GL_FLOAT_VEC2:         func->glUniform2fv(location, 1, f); break;
+        case GL_FLOAT_VEC3:         func->glUniform3fv(location, 1, f); break;
+        case GL_FLOAT_VEC4:         func->glUniform4fv(location, 1, f); break;
+        case GL_INT_VEC2:
+        case GL_BOOL_VEC2:          func->glUniform2iv(location, 1, i); break;
+        case GL_INT_VEC3:
+        case GL_BOOL_VEC3:          func->glUniform3iv(location, 1, i); break;
+        case GL_INT_VEC4:
+        case GL_BOOL_VEC4:          func->glUniform4iv(location, 1, i); break;
+        case GL_UNSIGNED_INT:       func->glUniform1uiv(location, 1, u); break;
+        case GL_UNSIGNED_INT_VEC2:  func->glUniform2uiv(location, 1, u); break;
+        case GL_UNSIGNED_INT_VEC3:  func->glUniform3uiv(location, 1, u); break;
+        case GL_UNSIGNED_INT_VEC4:  func->glUniform4uiv(location, 1, u); break;
+        case GL_FLOAT_MAT2:         func->glUniformMatrix2fv(location, 1, GL_TRUE, f); break;
+        case GL_FLOAT_MAT2x3:       func->glUniformMatrix2x3fv(location, 1, GL_TRUE, f); break;
+        case GL_FLOAT_MAT2x4:       func->glUniformMatrix2x4fv(location, 1, GL_TRUE, f); break;
+        case GL_FLOAT_MAT3x2:       func->glUniformMatrix3x2fv(location, 1, GL_TRUE, f); break;
+        case GL_FLOAT_MAT3:         func->glUniformMatrix3fv(location, 1, GL_TRUE, f); break;
+        case GL_FLOAT_MAT3x4:       func->glUniformMatrix3x4fv(location, 1, GL_TRUE, f); break;
+        case GL_FLOAT_MAT4x2:       func->glUniformMatrix4x2fv(location, 1, GL_TRUE, f); break;
+        case GL_FLOAT_MAT4x3:       func->glUniformMatrix4x3fv(location, 1, GL_TRUE, f); break;
+        case GL_FLOAT_MAT4:         func->glUniformMatrix4fv(location, 1, GL_TRUE, f); break;
+        // int, bool, samplers and images
+        default:                    func->glUniform1iv(location, 1, i); break;
+        }
+    }
+
+    static GLenum shader_stage(ShaderType type)
+    {
+        switch (type)
+        {
+        case ShaderType::Vertex:
+            return GL_VERTEX_SHADER;
+        case ShaderType::Fragment:
+            return GL_FRAGMENT_SHADER;
+        case ShaderType::Geometry:
+            return GL_GEOMETRY_SHADER;
+        case ShaderType::TessControl:
+            return GL_TESS_CONTROL_SHADER;
+        case ShaderType::TessEvaluation:
+            return GL_TESS_EVALUATION_SHADER;
+        case ShaderType::Compute:
+            return GL_COMPUTE_SHADER;
+        default:
+            return GL_NONE;
+        }
+    }
+
+    std::atomic<GLProgramCache*> GLProgram::s_binary_cache = nullptr;
+
     GLProgram::GLProgram(GLContext* context)
     {
         m_context = context;
@@ -53,148 +149,354 @@ namespace GL
 
     GLProgram::~GLProgram()
     {
-        auto func = m_context->get_func();
-        func->glUseProgram(0);
-        func->glDeleteProgram(m_program);
+        GLStateCache::current(m_context).program_deleted(m_program);
+        m_context->get_func()->glDeleteProgram(m_program);
     }
 
     void GLProgram::attach_shader(ShaderType type, const char* source)
+    {
+        // compiled in link, which may not need to compile at all
+        m_sources.emplace_back(type, source);
+    }
+
+    bool GLProgram::link()
+    {
+        begin_link();
+        bool linked = end_link();
+        collect_uniforms();
+        return linked;
+    }
+
+    void GLProgram::begin_link()
     {
         auto func = m_context->get_func();
-        switch (type)
+
+        GLProgramCache* cache = s_binary_cache.load();
+        GLint binary_formats = 0;
+        if (cache != nullptr && func->glProgramBinary != nullptr)
+            func->glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binary_formats);
+
+        m_binary_cache = binary_formats > 0 ? cache : nullptr;
+        m_from_binary = false;
+        if (m_binary_cache != nullptr)
         {
-            case ShaderType::Vertex:
-            {
-                m_vertex = func->glCreateShader(GL_VERTEX_SHADER);
-                func->glShaderSource(m_vertex, 1, &source, nullptr);
-                func->glCompileShader(m_vertex);
-                check_program(func, ProgramStatus::compile, m_vertex);
+            m_binary_key = binary_key(func);
 
-                func->glAttachShader(m_program, m_vertex);
-                break;
-            }
-            case ShaderType::Fragment:
+            GLProgramBinary binary;
+            if (m_binary_cache->find(m_binary_key, binary))
             {
-                m_fragment = func->glCreateShader(GL_FRAGMENT_SHADER);
-                func->glShaderSource(m_fragment, 1, &source, nullptr);
-                func->glCompileShader(m_fragment);
-                check_program(func, ProgramStatus::compile, m_fragment);
+                func->glProgramBinary(m_program, binary.format, binary.data.data(), static_cast<GLsizei>(binary.data.size()));
 
-                func->glAttachShader(m_program, m_fragment);
-                break;
+                // a driver update may reject binaries under the same version string, compile instead
+                GLint status = GL_FALSE;
+                func->glGetProgramiv(m_program, GL_LINK_STATUS, &status);
+                m_from_binary = status == GL_TRUE;
             }
-            default:
-                break;
+
+            if (!m_from_binary)
+                func->glProgramParameteri(m_program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
         }
+
+        if (m_from_binary)
+            return;
+
+        // every status query waits for the driver, so nothing is queried until end_link
+        for (auto& [type, source] : m_sources)
+        {
+            GLuint shader = func->glCreateShader(shader_stage(type));
+            const char* text = source.c_str();
+            func->glShaderSource(shader, 1, &text, nullptr);
+            func->glCompileShader(shader);
+
+            func->glAttachShader(m_program, shader);
+            m_shaders.push_back(shader);
+        }
+
+        func->glLinkProgram(m_program);
     }
 
-    void GLProgram::link() const
+    bool GLProgram::end_link()
     {
+        if (m_from_binary)
+            return true;
+
         auto func = m_context->get_func();
-        func->glLinkProgram(m_program);
-        check_program(func, ProgramStatus::link, m_program);
 
-        func->glDeleteShader(m_vertex);
-        func->glDeleteShader(m_fragment);
+        bool linked = check_program(func, ProgramStatus::link, m_program);
+        if (!linked)
+        {
+            for (GLuint shader : m_shaders)
+                check_program(func, ProgramStatus::compile, shader);
+        }
+
+        for (GLuint shader : m_shaders)
+        {
+            func->glDetachShader(m_program, shader);
+            func->glDeleteShader(shader);
+        }
+        m_shaders.clear();
+
+        if (linked && m_binary_cache != nullptr)
+        {
+            GLint length = 0;
+            func->glGetProgramiv(m_program, GL_PROGRAM_BINARY_LENGTH, &length);
+
+            std::vector<uint8_t> data(length);
+            GLenum format = 0;
+            if (length > 0)
+                func->glGetProgramBinary(m_program, length, &length, &format, data.data());
+            if (length > 0)
+                m_binary_cache->store(m_binary_key, format, std::span<uint8_t const>(data.data(), length));
+        }
+
+        return linked;
+    }
+
+    bool GLProgram::is_link_completed() const
+    {
+        if (m_from_binary)
+            return true;
+
+        GLint completed = GL_FALSE;
+        m_context->get_func()->glGetProgramiv(m_program, GL_COMPLETION_STATUS_KHR, &completed);
+        return completed == GL_TRUE;
+    }
+
+    void GLProgram::collect_uniforms()
+    {
+        auto func = m_context->get_func();
+
+        m_uniforms.clear();
+        m_uniform_indices.clear();
+
+        m_work_group_size = {};
+        bool compute = std::ranges::any_of(m_sources, [](auto const& source) { return source.first == ShaderType::Compute; });
+        GLint linked = GL_FALSE;
+        func->glGetProgramiv(m_program, GL_LINK_STATUS, &linked);
+        if (compute && linked == GL_TRUE)
+            func->glGetProgramiv(m_program, GL_COMPUTE_WORK_GROUP_SIZE, m_work_group_size.data());
+
+        GLint count = 0, max_length = 0;
+        func->glGetProgramiv(m_program, GL_ACTIVE_UNIFORMS, &count);
+        func->glGetProgramiv(m_program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_length);
+
+        std::vector<char> buffer(std::max(max_length, 1));
+        for (GLint i = 0; i < count; i++)
+        {
+            GLint elements = 0;
+            GLenum type = 0;
+            func->glGetActiveUniform(m_program, i, static_cast<GLsizei>(buffer.size()), nullptr, &elements, &type, buffer.data());
+
+            // arrays are reported as name[0], accept the bare name too
+            std::string name = buffer.data();
+            if (name.ends_with("[0]"))
+                name.resize(name.size() - 3);
+
+            for (GLint element = 0; element < elements; element++)
+            {
+                std::string element_name = elements > 1 ? name + "[" + std::to_string(element) + "]" : name;
+                // block members and builtins have no location
+                GLint location = func->glGetUniformLocation(m_program, element_name.c_str());
+                if (location < 0)
+                    continue;
+
+                Uniform uniform;
+                uniform.location = location;
+                uniform.type = type;
+                uniform.base = declared_base(type);
+                uniform.size = static_cast<uint32_t>(uniform_size(type));
+
+                int index = static_cast<int>(m_uniforms.size());
+                m_uniforms.push_back(uniform);
+                m_uniform_indices.emplace(element_name, index);
+                if (element == 0 && elements > 1)
+                {
+                    m_uniform_indices.emplace(name, index);
+                    m_uniform_indices.emplace(name + "[0]", index);
+                }
+            }
+        }
     }
 
     void GLProgram::use() const
     {
-        m_context->get_func()->glUseProgram(m_program);
+        GLStateCache::current(m_context).use_program(m_program);
     }
 
     void GLProgram::release() const
     {
-        m_context->get_func()->glUseProgram(0);
+        GLStateCache::current(m_context).use_program(0);
     }
 
-    void GLProgram::set_uniform_value(const char* name, const bool& value) const
+    void GLProgram::dispatch(uint32_t x, uint32_t y, uint32_t z, GLbitfield barriers) const
     {
         auto func = m_context->get_func();
-        func->glUniform1i(func->glGetUniformLocation(m_program, name), static_cast<int>(value));
+
+        func->glDispatchCompute(x, y, z);
+        if (barriers != 0)
+            func->glMemoryBarrier(barriers);
+    }
+
+    void GLProgram::dispatch_threads(uint32_t width, uint32_t height, uint32_t depth, GLbitfield barriers) const
+    {
+        assert(m_work_group_size[0] > 0);
+
+        auto groups = [](uint32_t count, int32_t size) { return (count + size - 1) / static_cast<uint32_t>(size); };
+        dispatch(groups(width, m_work_group_size[0]), groups(height, m_work_group_size[1]), groups(depth, m_work_group_size[2]), barriers);
+    }
+
+    std::array<int32_t, 3> GLProgram::work_group_size() const
+    {
+        return m_work_group_size;
+    }
+
+    void GLProgram::set_uniform_value(const char* name, const bool& value) const
+    {
+        int32_t v = value;
+        write_uniform(uniform_index(name), UniformBase::Bool, &v, sizeof(v));
     }
 
     void GLProgram::set_uniform_value(const char* name, const int32_t& value) const
     {
-        auto func = m_context->get_func();
-        func->glUniform1i(func->glGetUniformLocation(m_program, name), value);
+        write_uniform(uniform_index(name), UniformBase::Int, &value, sizeof(value));
     }
 
     void GLProgram::set_uniform_value(const char* name, const float& value) const
     {
-        auto func = m_context->get_func();
-        func->glUniform1f(func->glGetUniformLocation(m_program, name), value);
+        write_uniform(uniform_index(name), UniformBase::Float, &value, sizeof(value));
     }
 
     void GLProgram::set_uniform_value(const char* name, const float& v1, const float& v2) const
     {
-        auto func = m_context->get_func();
-        func->glUniform2f(func->glGetUniformLocation(m_program, name), v1, v2);
+        const float values[] = {v1, v2};
+        write_uniform(uniform_index(name), UniformBase::Float, values, sizeof(values));
+    }
+
+    void GLProgram::set_uniform_value(const char* name, const float& v1, const float& v2, const float& v3) const
+    {
+        const float values[] = {v1, v2, v3};
+        write_uniform(uniform_index(name), UniformBase::Float, values, sizeof(values));
     }
 
     void GLProgram::set_uniform_value(const char* name, const float* matrix, int rows, int cols) const
     {
-        auto func = m_context->get_func();
-        switch (rows)
-        {
-        case 2:
+        // the shape comes from the declared glsl type, rows and cols only size the data
+        write_uniform(uniform_index(name), UniformBase::Float, matrix, sizeof(float) * rows * cols);
+    }
+
+    void GLProgram::attribute_location(const char* name) const
+    {
+        m_context->get_func()->glGetAttribLocation(m_program, name);
+    }
+
+    bool GLProgram::is_from_binary() const
+    {
+        return m_from_binary;
+    }
+
+    void GLProgram::set_binary_cache(GLProgramCache* cache)
+    {
+        s_binary_cache = cache;
+    }
+
+    uint64_t GLProgram::binary_key(GLFunctions const* func) const
+    {
+        auto bytes = [](std::string_view text) { return std::span(reinterpret_cast<uint8_t const*>(text.data()), text.size()); };
+
+        // a binary is only valid for the driver that produced it
+        uint64_t key = GLProgramCache::hash({});
+        for (GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION})
         {
-            switch (cols)
-            {
-            case 2:
-                func->glUniformMatrix2fv(func->glGetUniformLocation(m_program, name), 1, GL_TRUE, matrix);
-                break;
-            case 3:
-                func->glUniformMatrix2x3fv(func->glGetUniformLocation(m_program, name), 1, GL_TRUE, matrix);
-                break;
-            case 4:
-                func->glUniformMatrix2x4fv(func->glGetUniformLocation(m_program, name), 1, GL_TRUE, matrix);
-                break;
-            default:
-                break;
-            }
+            auto value = reinterpret_cast<const char*>(func->glGetString(name));
+            key = GLProgramCache::hash(bytes(value != nullptr ? value : ""), key);
+            key = GLProgramCache::hash(bytes(std::string_view("", 1)), key);
         }
-        case 3:
+
+        for (auto& [type, source] : m_sources)
         {
-            switch (cols)
-            {
-            case 2:
-                func->glUniformMatrix3x2fv(func->glGetUniformLocation(m_program, name), 1, GL_TRUE, matrix);
-                break;
-            case 3:
-                func->glUniformMatrix3fv(func->glGetUniformLocation(m_program, name), 1, GL_TRUE, matrix);
-                break;
-            case 4:
-                func->glUniformMatrix3x4fv(func->glGetUniformLocation(m_program, name), 1, GL_TRUE, matrix);
-                break;
-            default:
-                break;
-            }
+            uint8_t stage = static_cast<uint8_t>(type);
+            key = GLProgramCache::hash(std::span(&stage, 1), key);
+            key = GLProgramCache::hash(bytes(source), key);
+            key = GLProgramCache::hash(bytes(std::string_view("", 1)), key);
         }
-        case 4:
+        return key;
+    }
+
+    int GLProgram::uniform_location(const char* name) const
+    {
+        int index = uniform_index(name);
+        return index < 0 ? -1 : m_uniforms[index].location;
+    }
+
+    GLProgram::UniformBase GLProgram::declared_base(uint32_t type)
+    {
+        switch (type)
         {
-            switch (cols)
-            {
-            case 2:
-                func->glUniformMatrix4x2fv(func->glGetUniformLocation(m_program, name), 1, GL_TRUE, matrix);
-                break;
-            case 3:
-                func->glUniformMatrix4x3fv(func->glGetUniformLocation(m_program, name), 1, GL_TRUE, matrix);
-                break;
-            case 4:
-                func->glUniformMatrix4fv(func->glGetUniformLocation(m_program, name), 1, GL_TRUE, matrix);
-                break;
-            default:
-                break;
-            }
-        }
+        case GL_FLOAT: case GL_FLOAT_VEC2: case GL_FLOAT_VEC3: case GL_FLOAT_VEC4:
+        case GL_FLOAT_MAT2: case GL_FLOAT_MAT2x3: case GL_FLOAT_MAT2x4:
+        case GL_FLOAT_MAT3: case GL_FLOAT_MAT3x2: case GL_FLOAT_MAT3x4:
+        case GL_FLOAT_MAT4: case GL_FLOAT_MAT4x2: case GL_FLOAT_MAT4x3:
+            return UniformBase::Float;
+        case GL_UNSIGNED_INT: case GL_UNSIGNED_INT_VEC2: case GL_UNSIGNED_INT_VEC3: case GL_UNSIGNED_INT_VEC4:
+            return UniformBase::Uint;
+        case GL_BOOL: case GL_BOOL_VEC2: case GL_BOOL_VEC3: case GL_BOOL_VEC4:
+            return UniformBase::Bool;
+        // int, samplers and images
         default:
-              break;
+            return UniformBase::Int;
         }
     }
 
-    void GLProgram::attribute_location(const char* name) const
+    int GLProgram::uniform_index(const char* name) const
     {
-        m_context->get_func()->glGetAttribLocation(m_program, name);
+        auto iter = m_uniform_indices.find(std::string_view(name));
+        return iter != m_uniform_indices.end() ? iter->second : -1;
+    }
+
+    bool GLProgram::accepts(UniformBase declared, UniformBase base)
+    {
+        return declared == base || declared == UniformBase::Bool;
+    }
+
+    int GLProgram::uniform_index(const char* name, UniformBase base, size_t size) const
+    {
+        int index = uniform_index(name);
+        if (index < 0 || !accepts(m_uniforms[index].base, base) || m_uniforms[index].size != size)
+            return -1;
+        return index;
+    }
+
+    void GLProgram::write_uniform(int index, UniformBase base, void const* data, size_t size) const
+    {
+        if (index < 0)
+            return;
+
+        Uniform& uniform = m_uniforms[index];
+        // a mismatched type or size is the same mistake glUniform would reject,
+        // sending it through the declared type's entry point would reinterpret the bits instead
+        if (!error_chk(accepts(uniform.base, base) && uniform.size == size, "uniform type or size mismatch\n"))
+            return;
+
+        // glUniform sets bools from any scalar type, store 0 / 1 so equal values compare equal
+        std::array<int32_t, 4> flags{};
+        if (uniform.base == UniformBase::Bool && base != UniformBase::Bool)
+        {
+            for (size_t i = 0; i < size / sizeof(int32_t); i++)
+            {
+                if (base == UniformBase::Float)
+                    flags[i] = static_cast<float const*>(data)[i] != 0.0f;
+                else
+                    flags[i] = static_cast<int32_t const*>(data)[i] != 0;
+            }
+            data = flags.data();
+        }
+
+        if (uniform.cached && std::memcmp(uniform.value.data(), data, size) == 0)
+            return;
+
+        std::memcpy(uniform.value.data(), data, size);
+        uniform.cached = true;
+
+        send_uniform(m_context->get_func(), uniform.type, uniform.location, data);
     }
 }
@@ -0,0 +1,228 @@
+#include <GLProgramCache.h>
+
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace GL
+{
+    static constexpr char Cache_Magic[8] = {'G', 'L', 'P', 'R', 'G', 'B', 'I', 'N'};
+    static constexpr uint32_t Cache_Version = 1;
+
+    struct CacheHeader
+    {
+        char        magic[8];
+        uint32_t    version;
+        uint32_t    reserved;
+    };
+
+    // followed by size bytes of binary, padded so the next record stays 8 byte aligned
+    struct CacheRecord
+    {
+        uint64_t    key;
+        uint32_t    format;
+        uint32_t    size;
+    };
+
+    static size_t padded(size_t size)
+    {
+        return (size + 7) & ~static_cast<size_t>(7);
+    }
+
+    GLProgramCache::GLProgramCache(std::filesystem::path path) : m_path(std::move(path))
+    {
+        map();
+    }
+
+    GLProgramCache::~GLProgramCache()
+    {
+        unmap();
+    }
+
+    bool GLProgramCache::find(uint64_t key, GLProgramBinary& binary) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto stored = m_stored.find(key);
+        if (stored != m_stored.end())
+        {
+            binary.format = stored->second.format;
+            binary.data = std::span<uint8_t const>(stored->second.data, stored->second.size);
+            return true;
+        }
+
+        auto iter = m_entries.find(key);
+        if (iter == m_entries.end())
+            return false;
+
+        binary.format = iter->second.format;
+        binary.data = std::span<uint8_t const>(iter->second.data, iter->second.size);
+        return true;
+    }
+
+    void GLProgramCache::store(uint64_t key, uint32_t format, std::span<uint8_t const> data)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        std::ofstream file;
+        if (m_valid)
+            file.open(m_path, std::ios::binary | std::ios::app);
+        else
+        {
+            std::error_code error;
+            if (m_path.has_parent_path())
+                std::filesystem::create_directories(m_path.parent_path(), error);
+
+            file.open(m_path, std::ios::binary | std::ios::trunc);
+
+            CacheHeader header{};
+            std::memcpy(header.magic, Cache_Magic, sizeof(Cache_Magic));
+            header.version = Cache_Version;
+            file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        }
+
+        CacheRecord record{key, format, static_cast<uint32_t>(data.size())};
+        const char padding[8] = {};
+        file.write(reinterpret_cast<char const*>(&record), sizeof(record));
+        file.write(reinterpret_cast<char const*>(data.data()), static_cast<std::streamsize>(data.size()));
+        file.write(padding, static_cast<std::streamsize>(padded(data.size()) - data.size()));
+        file.close();
+
+        // an unwritable path still caches for this process
+        m_valid = m_valid || !file.fail();
+
+        std::vector<uint8_t> const& blob = m_blobs.emplace_back(data.begin(), data.end());
+        m_stored[key] = {format, blob.data(), blob.size()};
+    }
+
+    size_t GLProgramCache::size() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        size_t count = m_stored.size();
+        for (auto& [key, entry] : m_entries)
+        {
+            if (!m_stored.contains(key))
+                count++;
+        }
+        return count;
+    }
+
+    std::filesystem::path const& GLProgramCache::path() const
+    {
+        return m_path;
+    }
+
+    uint64_t GLProgramCache::hash(std::span<uint8_t const> data, uint64_t seed)
+    {
+        uint64_t hash = seed;
+        for (uint8_t byte : data)
+        {
+            hash ^= byte;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    void GLProgramCache::map()
+    {
+#ifdef _WIN32
+        HANDLE file = CreateFileW(m_path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return;
+
+        LARGE_INTEGER size;
+        if (GetFileSizeEx(file, &size) && size.QuadPart >= static_cast<LONGLONG>(sizeof(CacheHeader)))
+        {
+            HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr)
+            {
+                m_mapping = static_cast<uint8_t const*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                if (m_mapping != nullptr)
+                {
+                    m_mapped = static_cast<size_t>(size.QuadPart);
+                    m_handle = mapping;
+                }
+                else
+                    CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+#else
+        int file = open(m_path.c_str(), O_RDONLY);
+        if (file < 0)
+            return;
+
+        struct stat info{};
+        if (fstat(file, &info) == 0 && info.st_size >= static_cast<off_t>(sizeof(CacheHeader)))
+        {
+            void* mapping = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+            if (mapping != MAP_FAILED)
+            {
+                m_mapping = static_cast<uint8_t const*>(mapping);
+                m_mapped = static_cast<size_t>(info.st_size);
+            }
+        }
+        // the mapping keeps the file referenced
+        close(file);
+#endif
+        if (m_mapping == nullptr)
+            return;
+
+        CacheHeader header;
+        std::memcpy(&header, m_mapping, sizeof(header));
+        if (std::memcmp(header.magic, Cache_Magic, sizeof(Cache_Magic)) != 0 || header.version != Cache_Version)
+        {
+            unmap();
+            return;
+        }
+
+        size_t offset = sizeof(CacheHeader);
+        while (offset < m_mapped)
+        {
+            CacheRecord record;
+            if (m_mapped - offset < sizeof(record))
+                break;
+            std::memcpy(&record, m_mapping + offset, sizeof(record));
+            if (m_mapped - offset - sizeof(record) < padded(record.size))
+                break;
+
+            m_entries[record.key] = {record.format, m_mapping + offset + sizeof(record), record.size};
+            offset += sizeof(record) + padded(record.size);
+        }
+
+        // a record cut short by a crash while appending would hide everything appended after it,
+        // start over and let the next store rewrite the file
+        if (offset != m_mapped)
+        {
+            unmap();
+            return;
+        }
+        m_valid = true;
+    }
+
+    void GLProgramCache::unmap()
+    {
+        if (m_mapping == nullptr)
+            return;
+
+#ifdef _WIN32
+        UnmapViewOfFile(m_mapping);
+        CloseHandle(static_cast<HANDLE>(m_handle));
+        m_handle = nullptr;
+#else
+        munmap(const_cast<uint8_t*>(m_mapping), m_mapped);
+#endif
+        m_mapping = nullptr;
+        m_mapped = 0;
+        m_entries.clear();
+    }
+}
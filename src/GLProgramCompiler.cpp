@@ -0,0 +1,150 @@
+#include <GLFunctions.h>
+#include <GLExtFunctions.h>
+#include <GLProgram.h>
+#include <GLProgramCompiler.h>
+#include <GLShareGroup.h>
+
+#include <chrono>
+
+namespace GL
+{
+    bool GLProgramCompiler::Pending::ready() const
+    {
+        if (m_done || m_program == nullptr)
+            return true;
+
+        if (m_result.valid())
+            return m_result.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+
+        return m_parallel ? m_program->is_link_completed() : false;
+    }
+
+    bool GLProgramCompiler::Pending::wait()
+    {
+        if (m_done || m_program == nullptr)
+            return m_linked;
+
+        // a worker already waited for the driver, only the uniforms are left
+        m_linked = m_result.valid() ? m_result.get() : m_program->end_link();
+        m_program->collect_uniforms();
+        m_done = true;
+
+        return m_linked;
+    }
+
+    GLProgram* GLProgramCompiler::Pending::program() const
+    {
+        return m_program;
+    }
+
+
+    GLProgramCompiler::GLProgramCompiler(size_t worker_count, GLContext* context, bool driver_parallel) : m_context(context)
+    {
+        m_parallel = driver_parallel && m_context->has_extension("GL_KHR_parallel_shader_compile");
+        if (m_parallel)
+        {
+            // the default thread count is implementation defined and may be zero
+            m_context->get_ext_func()->glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+            return;
+        }
+
+        GLShareGroup* group = m_context->share_group();
+        if (group == nullptr)
+            return;
+
+        for (size_t i = 0; i < worker_count; i++)
+        {
+            GLContext* worker = create_offscreen_context(*group);
+            if (worker == nullptr)
+                break;
+
+            // made current again by its thread
+            worker->release();
+            m_worker_contexts.push_back(worker);
+        }
+        m_context->activate();
+
+        for (auto worker : m_worker_contexts)
+            m_workers.emplace_back(&GLProgramCompiler::work, this, worker);
+    }
+
+    GLProgramCompiler::~GLProgramCompiler()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_all();
+
+        for (auto& worker : m_workers)
+            worker.join();
+
+        for (auto worker : m_worker_contexts)
+            destroy_context(worker);
+    }
+
+    GLProgramCompiler::Pending GLProgramCompiler::submit(GLProgram* program)
+    {
+        Pending pending;
+        pending.m_program = program;
+        pending.m_parallel = m_parallel;
+
+        if (m_workers.empty())
+        {
+            // compiles are queued in the driver, status is only queried by wait
+            program->begin_link();
+            return pending;
+        }
+
+        std::packaged_task<bool()> job([program]
+        {
+            program->begin_link();
+            bool linked = program->end_link();
+            // end_link already waited for the link, flush so the result is visible to the submitting context
+            GLContext::current_context()->get_func()->glFlush();
+            return linked;
+        });
+        pending.m_result = job.get_future();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_jobs.push_back(std::move(job));
+        }
+        m_condition.notify_one();
+
+        return pending;
+    }
+
+    bool GLProgramCompiler::is_parallel() const
+    {
+        return m_parallel;
+    }
+
+    size_t GLProgramCompiler::worker_count() const
+    {
+        return m_workers.size();
+    }
+
+    void GLProgramCompiler::work(GLContext* context)
+    {
+        context->activate();
+
+        while (true)
+        {
+            std::packaged_task<bool()> job;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this] { return m_stop || !m_jobs.empty(); });
+                if (m_jobs.empty())
+                    break;
+
+                job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+            }
+
+            job();
+        }
+
+        context->release();
+    }
+}
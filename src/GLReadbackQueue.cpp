@@ -0,0 +1,275 @@
+#include <GLFunctions.h>
+#include <GLExtFunctions.h>
+#include <GLReadbackQueue.h>
+
+#include <algorithm>
+#include <cassert>
+
+namespace GL
+{
+    static size_t pixel_size(GLenum format, GLenum type)
+    {
+        switch (type)
+        {
+        // packed types carry the whole pixel
+        case GL_UNSIGNED_INT_2_10_10_10_REV:
+        case GL_UNSIGNED_INT_10F_11F_11F_REV:
+        case GL_UNSIGNED_INT_5_9_9_9_REV:
+            return 4;
+        case GL_UNSIGNED_SHORT_5_6_5:
+        case GL_UNSIGNED_SHORT_4_4_4_4:
+        case GL_UNSIGNED_SHORT_5_5_5_1:
+            return 2;
+        default:
+            break;
+        }
+
+        size_t components = 4;
+        switch (format)
+        {
+        case GL_RED:
+        case GL_RED_INTEGER:
+            components = 1;
+            break;
+        case GL_RG:
+        case GL_RG_INTEGER:
+            components = 2;
+            break;
+        case GL_RGB:
+        case GL_RGB_INTEGER:
+            components = 3;
+            break;
+        default:
+            break;
+        }
+
+        switch (type)
+        {
+        case GL_UNSIGNED_BYTE:
+        case GL_BYTE:
+            return components;
+        case GL_UNSIGNED_SHORT:
+        case GL_SHORT:
+        case GL_HALF_FLOAT:
+            return components * 2;
+        default:
+            return components * 4;
+        }
+    }
+
+    GLReadbackQueue::Frame::Frame(GLReadbackQueue* queue, size_t index) : m_queue(queue), m_index(index) {}
+
+    GLReadbackQueue::Frame::Frame(Frame&& other) noexcept : m_queue(other.m_queue), m_index(other.m_index)
+    {
+        other.m_queue = nullptr;
+    }
+
+    GLReadbackQueue::Frame& GLReadbackQueue::Frame::operator=(Frame&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+
+            m_queue = other.m_queue;
+            m_index = other.m_index;
+            other.m_queue = nullptr;
+        }
+        return *this;
+    }
+
+    GLReadbackQueue::Frame::~Frame()
+    {
+        reset();
+    }
+
+    std::span<uint8_t const> GLReadbackQueue::Frame::data() const
+    {
+        if (m_queue == nullptr)
+            return {};
+
+        return {m_queue->m_buffers[m_index].mapped, m_queue->m_size};
+    }
+
+    size_t GLReadbackQueue::Frame::stride() const
+    {
+        return m_queue != nullptr ? m_queue->m_stride : 0;
+    }
+
+    uint64_t GLReadbackQueue::Frame::sequence() const
+    {
+        return m_queue != nullptr ? m_queue->m_buffers[m_index].sequence : 0;
+    }
+
+    GLReadbackQueue::Frame::operator bool() const
+    {
+        return m_queue != nullptr;
+    }
+
+    void GLReadbackQueue::Frame::reset()
+    {
+        if (m_queue != nullptr)
+        {
+            m_queue->recycle(m_index);
+            m_queue = nullptr;
+        }
+    }
+
+
+    GLReadbackQueue::GLReadbackQueue(int width, int height, GLenum format, GLenum type, size_t depth, GLContext* context)
+        : m_context(context), m_buffers(std::max<size_t>(depth, 1)), m_width(width), m_height(height), m_format(format), m_type(type)
+    {
+        auto func = m_context->get_func();
+
+        GLint alignment = 4;
+        func->glGetIntegerv(GL_PACK_ALIGNMENT, &alignment);
+        m_stride = (static_cast<size_t>(m_width) * pixel_size(m_format, m_type) + alignment - 1) / alignment * alignment;
+        m_size = m_stride * m_height;
+
+        PFNGLBUFFERSTORAGEPROC buffer_storage = func->glBufferStorage;
+        if (buffer_storage == nullptr && m_context->has_extension("GL_EXT_buffer_storage"))
+            buffer_storage = m_context->get_ext_func()->glBufferStorageEXT;
+        m_persistent = buffer_storage != nullptr;
+
+        for (auto& buffer : m_buffers)
+        {
+            func->glGenBuffers(1, &buffer.id);
+            func->glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.id);
+
+            if (m_persistent)
+            {
+                // coherent, so the pixels are visible to the cpu as soon as the fence signals
+                GLbitfield flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+                buffer_storage(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(m_size), nullptr, flags);
+                buffer.mapped = static_cast<uint8_t*>(func->glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(m_size), flags));
+            }
+            else
+                func->glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(m_size), nullptr, GL_STREAM_READ);
+        }
+        func->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+
+    GLReadbackQueue::~GLReadbackQueue()
+    {
+        auto func = m_context->get_func();
+
+        for (auto& buffer : m_buffers)
+        {
+            // every frame must be released before the queue is destroyed
+            assert(buffer.state != BufferState::held);
+
+            if (buffer.fence != nullptr)
+                func->glDeleteSync(buffer.fence);
+
+            if (buffer.mapped != nullptr)
+            {
+                func->glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.id);
+                func->glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            }
+            func->glDeleteBuffers(1, &buffer.id);
+        }
+        func->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+
+    bool GLReadbackQueue::enqueue()
+    {
+        size_t index = (m_head + m_pending) % m_buffers.size();
+        Buffer& buffer = m_buffers[index];
+        if (buffer.state != BufferState::free)
+            return false;
+
+        auto func = m_context->get_func();
+
+        func->glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.id);
+        func->glReadPixels(0, 0, m_width, m_height, m_format, m_type, nullptr);
+        func->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        buffer.fence = func->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        // get the copy started now rather than at the first wait
+        func->glFlush();
+
+        buffer.sequence = m_sequence++;
+        buffer.state = BufferState::pending;
+        m_pending++;
+        return true;
+    }
+
+    std::optional<GLReadbackQueue::Frame> GLReadbackQueue::try_dequeue()
+    {
+        return take_oldest(0);
+    }
+
+    std::optional<GLReadbackQueue::Frame> GLReadbackQueue::dequeue()
+    {
+        return take_oldest(GL_TIMEOUT_IGNORED);
+    }
+
+    std::optional<GLReadbackQueue::Frame> GLReadbackQueue::take_oldest(GLuint64 timeout)
+    {
+        if (m_pending == 0)
+            return std::nullopt;
+
+        auto func = m_context->get_func();
+
+        size_t index = m_head;
+        Buffer& buffer = m_buffers[index];
+
+        GLenum result = func->glClientWaitSync(buffer.fence, 0, timeout);
+        if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED)
+            return std::nullopt;
+
+        func->glDeleteSync(buffer.fence);
+        buffer.fence = nullptr;
+
+        if (!m_persistent)
+        {
+            // the fence already waited for the copy, mapping won't stall
+            func->glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.id);
+            buffer.mapped = static_cast<uint8_t*>(func->glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(m_size), GL_MAP_READ_BIT));
+            func->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        }
+
+        buffer.state = BufferState::held;
+        m_head = (m_head + 1) % m_buffers.size();
+        m_pending--;
+
+        return Frame(this, index);
+    }
+
+    void GLReadbackQueue::recycle(size_t index)
+    {
+        Buffer& buffer = m_buffers[index];
+        assert(buffer.state == BufferState::held);
+
+        if (!m_persistent)
+        {
+            auto func = m_context->get_func();
+
+            func->glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.id);
+            func->glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            func->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+            buffer.mapped = nullptr;
+        }
+
+        buffer.state = BufferState::free;
+    }
+
+    size_t GLReadbackQueue::pending() const
+    {
+        return m_pending;
+    }
+
+    bool GLReadbackQueue::is_persistent() const
+    {
+        return m_persistent;
+    }
+
+    int GLReadbackQueue::width() const
+    {
+        return m_width;
+    }
+
+    int GLReadbackQueue::height() const
+    {
+        return m_height;
+    }
+}
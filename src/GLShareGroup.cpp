@@ -0,0 +1,35 @@
+#include <GLShareGroup.h>
+
+#include <cassert>
+
+namespace GL
+{
+    GLShareGroup::~GLShareGroup()
+    {
+        assert(m_members.empty());
+    }
+
+    size_t GLShareGroup::size() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_members.size();
+    }
+
+    GLShareGroup& GLShareGroup::default_group()
+    {
+        // never destroyed, contexts may outlive static destruction
+        static GLShareGroup* group = new GLShareGroup;
+        return *group;
+    }
+
+    void GLShareGroup::leave(void* native)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto iter = std::find(m_members.begin(), m_members.end(), native);
+        assert(iter != m_members.end());
+        // any remaining member can serve as share root for later contexts
+        if (iter != m_members.end())
+            m_members.erase(iter);
+    }
+}
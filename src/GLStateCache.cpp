@@ -0,0 +1,236 @@
+#include <GLFunctions.h>
+#include <GLStateCache.h>
+
+#include <algorithm>
+
+namespace GL
+{
+    // no driver returns names or enums this large, a shadow holding it never matches
+    static constexpr GLuint Unknown = 0xFFFFFFFF;
+    static constexpr GLint Unknown_Viewport = -1;
+    static constexpr uint8_t Unknown_Flag = 0xFF;
+
+    static constexpr GLenum Texture_Target_List[] = {GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY, GL_TEXTURE_3D, GL_TEXTURE_CUBE_MAP};
+    static constexpr GLenum Capability_List[] = {GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE, GL_SCISSOR_TEST, GL_STENCIL_TEST};
+
+    // index into the shadow arrays, -1 when the value isn't tracked
+    template <size_t N>
+    static int index_of(GLenum const (&list)[N], GLenum value)
+    {
+        auto iter = std::find(std::begin(list), std::end(list), value);
+        return iter != std::end(list) ? static_cast<int>(iter - std::begin(list)) : -1;
+    }
+
+    GLStateCache::GLStateCache(GLContext const* context) : m_context(context)
+    {
+        invalidate();
+    }
+
+    template <typename T, typename Issue>
+    void GLStateCache::apply(T& shadow, T const& value, Issue&& issue)
+    {
+        if (m_enabled && shadow == value)
+        {
+            m_stats.elided++;
+            return;
+        }
+
+        issue(m_context->get_func());
+        shadow = value;
+        m_stats.issued++;
+    }
+
+    void GLStateCache::use_program(GLuint program)
+    {
+        apply(m_program, program, [&](GLFunctions const* func) { func->glUseProgram(program); });
+    }
+
+    void GLStateCache::bind_vertex_array(GLuint vertex_array)
+    {
+        apply(m_vertex_array, vertex_array, [&](GLFunctions const* func) { func->glBindVertexArray(vertex_array); });
+    }
+
+    void GLStateCache::active_texture(GLuint unit)
+    {
+        apply(m_active_unit, unit, [&](GLFunctions const* func) { func->glActiveTexture(GL_TEXTURE0 + unit); });
+    }
+
+    void GLStateCache::bind_texture(GLenum target, GLuint texture)
+    {
+        int index = index_of(Texture_Target_List, target);
+        if (index < 0 || m_active_unit >= Texture_Units)
+        {
+            m_context->get_func()->glBindTexture(target, texture);
+            m_stats.issued++;
+            return;
+        }
+
+        apply(m_textures[m_active_unit][index], texture, [&](GLFunctions const* func) { func->glBindTexture(target, texture); });
+    }
+
+    void GLStateCache::bind_texture(GLuint unit, GLenum target, GLuint texture)
+    {
+        // a binding already in place doesn't need the unit switch either
+        int index = index_of(Texture_Target_List, target);
+        if (m_enabled && index >= 0 && unit < Texture_Units && m_textures[unit][index] == texture)
+        {
+            m_stats.elided++;
+            return;
+        }
+
+        active_texture(unit);
+        bind_texture(target, texture);
+    }
+
+    void GLStateCache::bind_sampler(GLuint unit, GLuint sampler)
+    {
+        if (unit >= Texture_Units)
+        {
+            m_context->get_func()->glBindSampler(unit, sampler);
+            m_stats.issued++;
+            return;
+        }
+
+        apply(m_samplers[unit], sampler, [&](GLFunctions const* func) { func->glBindSampler(unit, sampler); });
+    }
+
+    void GLStateCache::bind_framebuffer(GLenum target, GLuint framebuffer)
+    {
+        switch (target)
+        {
+        case GL_DRAW_FRAMEBUFFER:
+            apply(m_draw_framebuffer, framebuffer, [&](GLFunctions const* func) { func->glBindFramebuffer(target, framebuffer); });
+            break;
+        case GL_READ_FRAMEBUFFER:
+            apply(m_read_framebuffer, framebuffer, [&](GLFunctions const* func) { func->glBindFramebuffer(target, framebuffer); });
+            break;
+        default:
+        {
+            // both bindings at once, only elided when both already match
+            std::array<GLuint, 2> shadow{m_draw_framebuffer, m_read_framebuffer};
+            apply(shadow, {framebuffer, framebuffer}, [&](GLFunctions const* func) { func->glBindFramebuffer(target, framebuffer); });
+            m_draw_framebuffer = shadow[0];
+            m_read_framebuffer = shadow[1];
+            break;
+        }
+        }
+    }
+
+    void GLStateCache::viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+    {
+        apply(m_viewport, {x, y, width, height}, [&](GLFunctions const* func) { func->glViewport(x, y, width, height); });
+    }
+
+    void GLStateCache::set_enabled(GLenum capability, bool enabled)
+    {
+        auto issue = [&](GLFunctions const* func)
+        {
+            if (enabled)
+                func->glEnable(capability);
+            else
+                func->glDisable(capability);
+        };
+
+        int index = index_of(Capability_List, capability);
+        if (index < 0)
+        {
+            issue(m_context->get_func());
+            m_stats.issued++;
+            return;
+        }
+
+        apply(m_capabilities[index], static_cast<uint8_t>(enabled), issue);
+    }
+
+    void GLStateCache::blend_func(GLenum src_rgb, GLenum dst_rgb, GLenum src_alpha, GLenum dst_alpha)
+    {
+        apply(m_blend_func, {src_rgb, dst_rgb, src_alpha, dst_alpha},
+            [&](GLFunctions const* func) { func->glBlendFuncSeparate(src_rgb, dst_rgb, src_alpha, dst_alpha); });
+    }
+
+    void GLStateCache::blend_equation(GLenum rgb, GLenum alpha)
+    {
+        apply(m_blend_equation, {rgb, alpha}, [&](GLFunctions const* func) { func->glBlendEquationSeparate(rgb, alpha); });
+    }
+
+    void GLStateCache::depth_func(GLenum func)
+    {
+        apply(m_depth_func, func, [&](GLFunctions const* functions) { functions->glDepthFunc(func); });
+    }
+
+    void GLStateCache::depth_mask(bool mask)
+    {
+        apply(m_depth_mask, static_cast<uint8_t>(mask), [&](GLFunctions const* func) { func->glDepthMask(mask ? GL_TRUE : GL_FALSE); });
+    }
+
+    void GLStateCache::texture_deleted(GLuint texture)
+    {
+        for (auto& unit : m_textures)
+            std::replace(unit.begin(), unit.end(), texture, 0u);
+    }
+
+    void GLStateCache::sampler_deleted(GLuint sampler)
+    {
+        std::replace(m_samplers.begin(), m_samplers.end(), sampler, 0u);
+    }
+
+    void GLStateCache::vertex_array_deleted(GLuint vertex_array)
+    {
+        if (m_vertex_array == vertex_array)
+            m_vertex_array = 0;
+    }
+
+    void GLStateCache::framebuffer_deleted(GLuint framebuffer)
+    {
+        if (m_draw_framebuffer == framebuffer)
+            m_draw_framebuffer = 0;
+        if (m_read_framebuffer == framebuffer)
+            m_read_framebuffer = 0;
+    }
+
+    void GLStateCache::program_deleted(GLuint program)
+    {
+        // a deleted program stays in use until something else is, unknown counts as in use
+        if (m_program == program || m_program == Unknown || !m_enabled)
+        {
+            m_context->get_func()->glUseProgram(0);
+            m_program = 0;
+            m_stats.issued++;
+        }
+    }
+
+    void GLStateCache::invalidate()
+    {
+        m_program = Unknown;
+        m_vertex_array = Unknown;
+        m_active_unit = Unknown;
+        for (auto& unit : m_textures)
+            unit.fill(Unknown);
+        m_samplers.fill(Unknown);
+        m_draw_framebuffer = Unknown;
+        m_read_framebuffer = Unknown;
+        m_viewport.fill(Unknown_Viewport);
+        m_capabilities.fill(Unknown_Flag);
+        m_blend_func.fill(Unknown);
+        m_blend_equation.fill(Unknown);
+        m_depth_func = Unknown;
+        m_depth_mask = Unknown_Flag;
+    }
+
+    GLStateCacheStats GLStateCache::stats() const
+    {
+        return m_stats;
+    }
+
+    GLStateCache& GLStateCache::current(GLContext const* fallback)
+    {
+        GLContext const* context = GLContext::current_context();
+        if (context != nullptr)
+            return *context->get_state();
+
+        thread_local GLStateCache untracked(nullptr);
+        untracked.m_context = fallback;
+        untracked.m_enabled = false;
+        return untracked;
+    }
+}
@@ -7,24 +7,123 @@
 #include <d3d11.h>
 #include <GLFunctions.h>
 #include <GLExtFunctions.h>
+#include <GLStateCache.h>
 #include <GLTexture.h>
 
 #include "platform/EGLContext.h"
+#include "platform/Utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
 
 namespace GL
 {
+    struct TextureFormat
+    {
+        GLenum      sized;
+        GLenum      format;
+        GLenum      type;
+        // bytes per texel
+        int         size;
+    };
+
+    // client format / type for each sized format, used when the context has no texture storage
+    static constexpr TextureFormat s_texture_formats[] =
+    {
+        {GL_R8,                    GL_RED,                GL_UNSIGNED_BYTE,                     1},
+        {GL_RG8,                   GL_RG,                 GL_UNSIGNED_BYTE,                     2},
+        {GL_RGB8,                  GL_RGB,                GL_UNSIGNED_BYTE,                     3},
+        {GL_RGBA8,                 GL_RGBA,               GL_UNSIGNED_BYTE,                     4},
+        {GL_SRGB8_ALPHA8,          GL_RGBA,               GL_UNSIGNED_BYTE,                     4},
+        {GL_R16,                   GL_RED,                GL_UNSIGNED_SHORT,                    2},
+        {GL_RG16,                  GL_RG,                 GL_UNSIGNED_SHORT,                    4},
+        {GL_RGB10_A2,              GL_RGBA,               GL_UNSIGNED_INT_2_10_10_10_REV,       4},
+        {GL_R16F,                  GL_RED,                GL_HALF_FLOAT,                        2},
+        {GL_RG16F,                 GL_RG,                 GL_HALF_FLOAT,                        4},
+        {GL_RGBA16F,               GL_RGBA,               GL_HALF_FLOAT,                        8},
+        {GL_R32F,                  GL_RED,                GL_FLOAT,                             4},
+        {GL_RG32F,                 GL_RG,                 GL_FLOAT,                             8},
+        {GL_RGBA32F,               GL_RGBA,               GL_FLOAT,                             16},
+        {GL_DEPTH_COMPONENT16,     GL_DEPTH_COMPONENT,    GL_UNSIGNED_SHORT,                    2},
+        {GL_DEPTH_COMPONENT24,     GL_DEPTH_COMPONENT,    GL_UNSIGNED_INT,                      4},
+        {GL_DEPTH_COMPONENT32F,    GL_DEPTH_COMPONENT,    GL_FLOAT,                             4},
+        {GL_DEPTH24_STENCIL8,      GL_DEPTH_STENCIL,      GL_UNSIGNED_INT_24_8,                 4},
+        {GL_DEPTH32F_STENCIL8,     GL_DEPTH_STENCIL,      GL_FLOAT_32_UNSIGNED_INT_24_8_REV,    8},
+    };
+
+    // never reused, unlike texture names
+    static std::atomic<uint64_t> s_serial = 0;
+
+    static TextureFormat const* find_texture_format(GLenum sized)
+    {
+        for (auto& format : s_texture_formats)
+        {
+            if (format.sized == sized)
+                return &format;
+        }
+        return nullptr;
+    }
+
     GLTexture::GLTexture(int width, int height, int internal_format, int encode_format, GLContext* context)
-        : m_context(context), m_width(width), m_height(height), m_internal(internal_format), m_format(encode_format)
+        : GLTexture(width, height, internal_format, encode_format, 1, context) {}
+
+    GLTexture::GLTexture(int width, int height, int internal_format, int encode_format, int levels, GLContext* context)
+        : m_context(context), m_width(width), m_height(height), m_internal(static_cast<int>(sized_format(internal_format))),
+          m_format(encode_format), m_levels(std::clamp(levels, 1, mip_levels(width, height))), m_serial(++s_serial)
     {
         m_context->get_func()->glGenTextures(1, &m_id);
+        allocate();
+    }
+
+    void GLTexture::allocate()
+    {
+        auto func = m_context->get_func();
+        GLStateCache& state = GLStateCache::current(m_context);
+
+        state.bind_texture(GL_TEXTURE_2D, m_id);
+        if (func->glTexStorage2D)
+            func->glTexStorage2D(GL_TEXTURE_2D, m_levels, m_internal, m_width, m_height);
+        else if (m_context->has_extension("GL_EXT_texture_storage"))
+            m_context->get_ext_func()->glTexStorage2DEXT(GL_TEXTURE_2D, m_levels, m_internal, m_width, m_height);
+        else
+        {
+            // gles 2.0 / gl < 4.2, mutable levels that nobody reallocates afterwards
+            TextureFormat const* format = find_texture_format(m_internal);
+            if (!error_chk(format != nullptr, "unsupported texture format without texture storage\n"))
+            {
+                state.bind_texture(GL_TEXTURE_2D, 0);
+                return;
+            }
+
+            // every es 3.x context has glTexStorage2D, so an es context here is 2.0 which only accepts unsized formats
+            GLint internal = m_context->is_opengl_es() ? static_cast<GLint>(format->format) : m_internal;
+            for (int level = 0; level < m_levels; level++)
+            {
+                func->glTexImage2D(GL_TEXTURE_2D, level, internal, std::max(m_width >> level, 1), std::max(m_height >> level, 1),
+                    0, format->format, format->type, nullptr);
+            }
+            // es 2.0 has no max level, a partial chain is only complete there when sampled without mipmaps
+            if (!m_context->is_opengl_es())
+                func->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, m_levels - 1);
+        }
+
+        // the default mipmapped min filter would sample missing levels
+        func->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+        func->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        func->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        func->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        state.bind_texture(GL_TEXTURE_2D, 0);
     }
 
 #if defined(_WIN32) && defined(GL_ES)
     GLTexture::GLTexture(HANDLE shared_handle, int width, int height, GLContext* context)
-        : m_context(context), m_width(width), m_height(height), m_internal(GL_RGBA), m_format(GL_RGBA)
+        : m_context(context), m_width(width), m_height(height), m_internal(GL_RGBA8), m_format(GL_RGBA), m_serial(++s_serial)
     {
         auto egl_context = dynamic_cast<EGLContext*>(m_context);
         auto func = egl_context->get_func();
+        GLStateCache& state = GLStateCache::current(m_context);
 
         EGLSurface surface = EGL_NO_SURFACE;
 
@@ -40,7 +139,7 @@ namespace GL
         surface = s_egl_funcs.eglCreatePbufferFromClientBuffer(egl_context->m_display, EGL_D3D_TEXTURE_2D_SHARE_HANDLE_ANGLE, shared_handle, egl_context->m_config, pb_attributes);
 
         func->glGenTextures(1, &m_id);
-        func->glBindTexture(GL_TEXTURE_2D, m_id);
+        state.bind_texture(GL_TEXTURE_2D, m_id);
 
         s_egl_funcs.eglBindTexImage(egl_context->m_display, surface, EGL_BACK_BUFFER);
 
@@ -76,6 +175,7 @@ namespace GL
     GLTexture::~GLTexture()
     {
         m_context->get_func()->glDeleteTextures(1, &m_id);
+        GLStateCache::current(m_context).texture_deleted(m_id);
     }
 
     GLuint GLTexture::id() const
@@ -102,4 +202,104 @@ namespace GL
     {
         return m_internal;
     }
+
+    int GLTexture::levels() const
+    {
+        return m_levels;
+    }
+
+    uint64_t GLTexture::serial() const
+    {
+        return m_serial;
+    }
+
+    void GLTexture::upload(void const* data, GLenum format, GLenum type, int level) const
+    {
+        assert(level >= 0 && level < m_levels);
+        auto func = m_context->get_func();
+        GLStateCache& state = GLStateCache::current(m_context);
+
+        state.bind_texture(GL_TEXTURE_2D, m_id);
+        func->glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, std::max(m_width >> level, 1), std::max(m_height >> level, 1), format, type, data);
+        state.bind_texture(GL_TEXTURE_2D, 0);
+    }
+
+    void GLTexture::generate_mipmaps() const
+    {
+        if (m_levels <= 1)
+            return;
+
+        auto func = m_context->get_func();
+        GLStateCache& state = GLStateCache::current(m_context);
+
+        state.bind_texture(GL_TEXTURE_2D, m_id);
+        func->glGenerateMipmap(GL_TEXTURE_2D);
+        state.bind_texture(GL_TEXTURE_2D, 0);
+    }
+
+    void GLTexture::set_filter(GLenum min_filter, GLenum mag_filter) const
+    {
+        auto func = m_context->get_func();
+        GLStateCache& state = GLStateCache::current(m_context);
+
+        state.bind_texture(GL_TEXTURE_2D, m_id);
+        func->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, min_filter);
+        func->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, mag_filter);
+        state.bind_texture(GL_TEXTURE_2D, 0);
+    }
+
+    void GLTexture::set_wrap(GLenum wrap_s, GLenum wrap_t) const
+    {
+        auto func = m_context->get_func();
+        GLStateCache& state = GLStateCache::current(m_context);
+
+        state.bind_texture(GL_TEXTURE_2D, m_id);
+        func->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrap_s);
+        func->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrap_t);
+        state.bind_texture(GL_TEXTURE_2D, 0);
+    }
+
+    void GLTexture::bind_image(GLuint unit, GLenum access, int level) const
+    {
+        m_context->get_func()->glBindImageTexture(unit, m_id, level, GL_FALSE, 0, access, static_cast<GLenum>(m_internal));
+    }
+
+    size_t GLTexture::memory_size() const
+    {
+        return memory_size(m_width, m_height, static_cast<GLenum>(m_internal), m_levels);
+    }
+
+    size_t GLTexture::memory_size(int width, int height, GLenum internal_format, int levels)
+    {
+        TextureFormat const* format = find_texture_format(sized_format(internal_format));
+        // formats missing from the table count as 4 bytes per texel
+        size_t texel = format != nullptr ? format->size : 4;
+
+        size_t size = 0;
+        for (int level = 0; level < levels; level++)
+            size += static_cast<size_t>(std::max(width >> level, 1)) * std::max(height >> level, 1) * texel;
+        return size;
+    }
+
+    int GLTexture::mip_levels(int width, int height)
+    {
+        return std::bit_width(static_cast<unsigned>(std::max({width, height, 1})));
+    }
+
+    GLenum GLTexture::sized_format(GLenum internal_format)
+    {
+        switch (internal_format)
+        {
+        case GL_RED:
+            return GL_R8;
+        case GL_RG:
+            return GL_RG8;
+        case GL_RGB:
+            return GL_RGB8;
+        case GL_RGBA:
+            return GL_RGBA8;
+        default:
+            return internal_format;
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,135 @@
+#include <GLFunctions.h>
+#include <GLTexture.h>
+#include <GLTexturePool.h>
+
+#include <algorithm>
+#include <cassert>
+
+namespace GL
+{
+    GLTexturePool::GLTexturePool(size_t budget, GLContext* context) : m_context(context), m_budget(budget) {}
+
+    GLTexturePool::~GLTexturePool()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // every texture must be released before the pool is destroyed
+        assert(m_in_use.empty());
+
+        evict(0);
+    }
+
+    GLTexture* GLTexturePool::acquire(int width, int height, int internal_format, int levels)
+    {
+        // the same normalization GLTexture applies, so GL_RGBA and GL_RGBA8 share a bucket
+        Key key{width, height, static_cast<int>(GLTexture::sized_format(internal_format)), std::clamp(levels, 1, GLTexture::mip_levels(width, height))};
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto iter = m_free.find(key);
+        if (iter != m_free.end() && !iter->second.empty())
+        {
+            // later releases in the bucket can't finish before the oldest one
+            Entry entry = iter->second.front();
+
+            auto func = m_context->get_func();
+            GLenum result = entry.fence != nullptr ? func->glClientWaitSync(entry.fence, 0, 0) : GL_ALREADY_SIGNALED;
+            if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+            {
+                if (entry.fence != nullptr)
+                    func->glDeleteSync(entry.fence);
+
+                iter->second.erase(iter->second.begin());
+                if (iter->second.empty())
+                    m_free.erase(iter);
+
+                m_in_use.insert(entry.texture);
+                m_stats.hits++;
+                m_stats.bytes_in_use += entry.texture->memory_size();
+                return entry.texture;
+            }
+        }
+
+        auto texture = new GLTexture(key.width, key.height, key.internal, key.internal, key.levels, m_context);
+        size_t size = texture->memory_size();
+
+        m_in_use.insert(texture);
+        m_stats.misses++;
+        m_stats.bytes_in_use += size;
+        m_stats.bytes_resident += size;
+        m_stats.peak_bytes_resident = std::max(m_stats.peak_bytes_resident, m_stats.bytes_resident);
+
+        evict(m_budget);
+        return texture;
+    }
+
+    void GLTexturePool::release(GLTexture* texture)
+    {
+        if (texture == nullptr)
+            return;
+
+        auto func = m_context->get_func();
+        // the fence lives in the caller's context, flush so other contexts of the group can see it signal
+        GLsync fence = func->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        func->glFlush();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        [[maybe_unused]] size_t erased = m_in_use.erase(texture);
+        assert(erased == 1);
+
+        Key key{texture->width(), texture->height(), texture->internal_format(), texture->levels()};
+        m_free[key].push_back({texture, fence, m_stamp++});
+        m_stats.bytes_in_use -= texture->memory_size();
+
+        evict(m_budget);
+    }
+
+    void GLTexturePool::clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        evict(0);
+    }
+
+    GLTexturePoolStats GLTexturePool::stats() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stats;
+    }
+
+    size_t GLTexturePool::budget() const
+    {
+        return m_budget;
+    }
+
+    void GLTexturePool::evict(size_t budget)
+    {
+        while (m_stats.bytes_resident > budget && !m_free.empty())
+        {
+            // the least recently released texture is the front of some bucket
+            auto oldest = m_free.begin();
+            for (auto iter = m_free.begin(); iter != m_free.end(); ++iter)
+            {
+                if (iter->second.front().stamp < oldest->second.front().stamp)
+                    oldest = iter;
+            }
+
+            Entry entry = oldest->second.front();
+            oldest->second.erase(oldest->second.begin());
+            if (oldest->second.empty())
+                m_free.erase(oldest);
+
+            destroy(entry);
+            m_stats.evictions++;
+        }
+    }
+
+    void GLTexturePool::destroy(Entry const& entry)
+    {
+        // deleting while the gpu still reads is fine, the driver keeps the storage alive until it is done
+        if (entry.fence != nullptr)
+            m_context->get_func()->glDeleteSync(entry.fence);
+
+        m_stats.bytes_resident -= entry.texture->memory_size();
+        delete entry.texture;
+    }
+}
@@ -0,0 +1,140 @@
+#include <GLFunctions.h>
+#include <GLExtFunctions.h>
+#include <GLStateCache.h>
+#include <GLTexture.h>
+#include <GLUploadRing.h>
+
+#include <algorithm>
+#include <cassert>
+
+namespace GL
+{
+    GLUploadRing::GLUploadRing(size_t slot_size, size_t slot_count, GLContext* context)
+        : m_context(context), m_buffers(std::max<size_t>(slot_count, 1)), m_slot_size(slot_size)
+    {
+        auto func = m_context->get_func();
+
+        PFNGLBUFFERSTORAGEPROC buffer_storage = func->glBufferStorage;
+        if (buffer_storage == nullptr && m_context->has_extension("GL_EXT_buffer_storage"))
+            buffer_storage = m_context->get_ext_func()->glBufferStorageEXT;
+        m_persistent = buffer_storage != nullptr;
+
+        for (auto& buffer : m_buffers)
+        {
+            func->glGenBuffers(1, &buffer.id);
+            func->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id);
+
+            if (m_persistent)
+            {
+                // coherent, so writes become visible without explicit flushes
+                GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+                buffer_storage(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(m_slot_size), nullptr, flags);
+                buffer.mapped = static_cast<uint8_t*>(func->glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>(m_slot_size), flags));
+            }
+            else
+                func->glBufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(m_slot_size), nullptr, GL_STREAM_DRAW);
+        }
+        func->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    GLUploadRing::~GLUploadRing()
+    {
+        auto func = m_context->get_func();
+
+        for (auto& buffer : m_buffers)
+        {
+            if (buffer.fence != nullptr)
+                func->glDeleteSync(buffer.fence);
+
+            if (buffer.mapped != nullptr)
+            {
+                func->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id);
+                func->glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            }
+            func->glDeleteBuffers(1, &buffer.id);
+        }
+        func->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    GLUploadRing::Slot GLUploadRing::acquire()
+    {
+        auto func = m_context->get_func();
+
+        size_t index = m_next;
+        Buffer& buffer = m_buffers[index];
+        // every slot is handed out once per lap, upload the oldest one before acquiring again
+        assert(!buffer.acquired);
+
+        if (buffer.fence != nullptr)
+        {
+            if (func->glClientWaitSync(buffer.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0) == GL_TIMEOUT_EXPIRED)
+            {
+                m_stall_count++;
+                func->glClientWaitSync(buffer.fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+            }
+
+            func->glDeleteSync(buffer.fence);
+            buffer.fence = nullptr;
+        }
+
+        if (!m_persistent)
+        {
+            // the fence guarantees the gpu is done with it, no need for the driver to synchronize again
+            func->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id);
+            buffer.mapped = static_cast<uint8_t*>(func->glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>(m_slot_size),
+                GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+            func->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        }
+
+        buffer.acquired = true;
+        m_next = (m_next + 1) % m_buffers.size();
+
+        return {index, buffer.mapped, m_slot_size};
+    }
+
+    void GLUploadRing::upload(Slot const& slot, GLTexture const& texture, GLenum format, GLenum type, int level)
+    {
+        auto func = m_context->get_func();
+        GLStateCache& state = GLStateCache::current(m_context);
+
+        Buffer& buffer = m_buffers[slot.index];
+        assert(buffer.acquired);
+
+        func->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id);
+        if (!m_persistent)
+        {
+            // a buffer can't source a copy while mapped
+            func->glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            buffer.mapped = nullptr;
+        }
+
+        state.bind_texture(GL_TEXTURE_2D, texture.id());
+        func->glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, std::max(texture.width() >> level, 1), std::max(texture.height() >> level, 1),
+            format, type, nullptr);
+        state.bind_texture(GL_TEXTURE_2D, 0);
+        func->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        buffer.fence = func->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        buffer.acquired = false;
+    }
+
+    bool GLUploadRing::is_persistent() const
+    {
+        return m_persistent;
+    }
+
+    size_t GLUploadRing::slot_size() const
+    {
+        return m_slot_size;
+    }
+
+    size_t GLUploadRing::slot_count() const
+    {
+        return m_buffers.size();
+    }
+
+    uint64_t GLUploadRing::stall_count() const
+    {
+        return m_stall_count;
+    }
+}
@@ -4,6 +4,7 @@
 
 #include <GLContext.h>
 #include <GLFunctions.h>
+#include <GLStateCache.h>
 #include <GLVao.h>
 
 namespace GL
@@ -21,8 +22,10 @@ namespace GL
     {
         auto func = m_context->get_func();
 
+        GLStateCache& state = GLStateCache::current(m_context);
+
         func->glGenVertexArrays(1, &m_vao);
-        func->glBindVertexArray(m_vao);
+        state.bind_vertex_array(m_vao);
 
         func->glGenBuffers(1, &m_vbo);
         func->glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
@@ -44,7 +47,7 @@ namespace GL
         }
 
         func->glBindBuffer(GL_ARRAY_BUFFER, 0);
-        func->glBindVertexArray(0);
+        state.bind_vertex_array(0);
     }
 
     GLVao::~GLVao()
@@ -53,16 +56,17 @@ namespace GL
 
         func->glDeleteBuffers(1, &m_vbo);
         func->glDeleteVertexArrays(1, &m_vao);
+        GLStateCache::current(m_context).vertex_array_deleted(m_vao);
     }
 
     void GLVao::bind() const
     {
-        m_context->get_func()->glBindVertexArray(m_vao);
+        GLStateCache::current(m_context).bind_vertex_array(m_vao);
     }
 
     void GLVao::unbind() const
     {
-        m_context->get_func()->glBindVertexArray(0);
+        GLStateCache::current(m_context).bind_vertex_array(0);
     }
 
     void GLVao::draw() const
@@ -3,6 +3,8 @@
 //
 
 #include <GLFunctions.h>
+#include <GLDevice.h>
+#include <GLShareGroup.h>
 
 #include "EGLContext.h"
 
@@ -11,6 +13,9 @@
 #include "PlatformGLContext.h"
 #include "Utils.h"
 
+#include <mutex>
+#include <unordered_map>
+
 #ifndef _WIN32
 #include <dlfcn.h>
 #endif
@@ -23,15 +28,14 @@ namespace GL
 #else
 #define EGL_CHK_AND_RET_FALSE(expr) if (!(expr)) { return false; }
 #endif
-    // fork form blender
-    static ::EGLContext s_shared_context = nullptr;
-    static int s_shared_count = 0;
-
 
     EGLFunctions s_egl_funcs;
 
     void EGLFunctions::initialize()
     {
+        static std::mutex mutex;
+        std::lock_guard<std::mutex> lock(mutex);
+
         if (!initialized)
         {
 #ifdef _WIN32
@@ -63,6 +67,13 @@ namespace GL
                 eglQueryDeviceAttribEXT = (PFNEGLQUERYDEVICEATTRIBEXTPROC)GetProcAddress(module, "eglQueryDeviceAttribEXT");
                 eglCreateImageKHR = (PFNEGLCREATEIMAGEKHRPROC)GetProcAddress(module, "eglCreateImageKHR");
 
+                if (eglGetProcAddress)
+                {
+                    eglGetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+                    eglQueryDevicesEXT = (PFNEGLQUERYDEVICESEXTPROC)eglGetProcAddress("eglQueryDevicesEXT");
+                    eglQueryDeviceStringEXT = (PFNEGLQUERYDEVICESTRINGEXTPROC)eglGetProcAddress("eglQueryDeviceStringEXT");
+                }
+
                 initialized = true;
             }
 #else
@@ -108,18 +119,24 @@ namespace GL
                 eglQueryDeviceAttribEXT = (PFNEGLQUERYDEVICEATTRIBEXTPROC)dlsym(module, "eglQueryDeviceAttribEXT");
                 eglCreateImageKHR = (PFNEGLCREATEIMAGEKHRPROC)dlsym(module, "eglCreateImageKHR");
 
+                if (eglGetProcAddress)
+                {
+                    eglGetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+                    eglQueryDevicesEXT = (PFNEGLQUERYDEVICESEXTPROC)eglGetProcAddress("eglQueryDevicesEXT");
+                    eglQueryDeviceStringEXT = (PFNEGLQUERYDEVICESTRINGEXTPROC)eglGetProcAddress("eglQueryDeviceStringEXT");
+                }
+
                 initialized = true;
             }
 #endif
         }
     }
 
-    static bool has_extension(EGLDisplay display, const char* extension)
+    static bool find_extension(const char* extensions, const char* extension)
     {
-        if (!s_egl_funcs.eglQueryString || !extension)
+        if (!extension)
             return false;
 
-        const char* extensions = s_egl_funcs.eglQueryString(display, EGL_EXTENSIONS);
         size_t len = strlen(extension);
 
         if (extensions == nullptr || *extensions == '\0')
@@ -138,7 +155,122 @@ namespace GL
         }
     }
 
-    static bool initialize_egl_context(EGLDisplay display, bool shared, const ContextConfig& context_config, ::EGLContext* context, EGLSurface* surface, EGLConfig* config)
+    // display extensions, or client extensions for EGL_NO_DISPLAY
+    static bool has_egl_extension(EGLDisplay display, const char* extension)
+    {
+        if (!s_egl_funcs.eglQueryString)
+            return false;
+
+        return find_extension(s_egl_funcs.eglQueryString(display, EGL_EXTENSIONS), extension);
+    }
+
+    static std::vector<EGLDeviceEXT> query_devices()
+    {
+        if (!s_egl_funcs.eglQueryDevicesEXT || !has_egl_extension(EGL_NO_DISPLAY, "EGL_EXT_device_enumeration"))
+            return {};
+
+        EGLint num_devices = 0;
+        if (!s_egl_funcs.eglQueryDevicesEXT(0, nullptr, &num_devices) || num_devices <= 0)
+            return {};
+
+        std::vector<EGLDeviceEXT> devices(num_devices);
+        if (!s_egl_funcs.eglQueryDevicesEXT(num_devices, devices.data(), &num_devices))
+            return {};
+
+        devices.resize(num_devices);
+        return devices;
+    }
+
+    static bool device_is_software(EGLDeviceEXT device)
+    {
+        if (!s_egl_funcs.eglQueryDeviceStringEXT)
+            return false;
+
+        return find_extension(s_egl_funcs.eglQueryDeviceStringEXT(device, EGL_EXTENSIONS), "EGL_MESA_device_software");
+    }
+
+    static EGLDisplay get_platform_display(EGLenum platform, void* native_display)
+    {
+        if (s_egl_funcs.eglGetPlatformDisplay)
+            return s_egl_funcs.eglGetPlatformDisplay(platform, native_display, nullptr);
+        if (s_egl_funcs.eglGetPlatformDisplayEXT)
+            return s_egl_funcs.eglGetPlatformDisplayEXT(platform, native_display, nullptr);
+        return EGL_NO_DISPLAY;
+    }
+
+    std::vector<GLDevice> enumerate_egl_devices()
+    {
+        s_egl_funcs.initialize();
+
+        std::vector<EGLDeviceEXT> devices = query_devices();
+
+        std::vector<GLDevice> result;
+        result.reserve(devices.size());
+        for (size_t i = 0; i < devices.size(); i++)
+        {
+            GLDevice device;
+            device.index = static_cast<int>(i);
+            device.software = device_is_software(devices[i]);
+
+            // without EGL_EXT_device_query the device has no strings, so no drm files either
+            const char* extensions = s_egl_funcs.eglQueryDeviceStringEXT ? s_egl_funcs.eglQueryDeviceStringEXT(devices[i], EGL_EXTENSIONS) : nullptr;
+            if (find_extension(extensions, "EGL_EXT_device_drm"))
+            {
+                const char* file = s_egl_funcs.eglQueryDeviceStringEXT(devices[i], EGL_DRM_DEVICE_FILE_EXT);
+                device.drm_device = file ? file : "";
+            }
+            if (find_extension(extensions, "EGL_EXT_device_drm_render_node"))
+            {
+                const char* file = s_egl_funcs.eglQueryDeviceStringEXT(devices[i], EGL_DRM_RENDER_NODE_FILE_EXT);
+                device.render_node = file ? file : "";
+            }
+
+            result.push_back(std::move(device));
+        }
+
+        return result;
+    }
+
+    // displays are initialized once and shared, the last context on a display terminates it
+    static std::mutex s_display_mutex;
+    static std::unordered_map<EGLDisplay, int> s_display_refs;
+
+    static EGLDisplay acquire_display(EGLDisplay display)
+    {
+        if (display == EGL_NO_DISPLAY)
+            return EGL_NO_DISPLAY;
+
+        std::lock_guard<std::mutex> lock(s_display_mutex);
+
+        int& refs = s_display_refs[display];
+        if (refs == 0)
+        {
+            EGLint major, minor;
+            if (!error_chk(s_egl_funcs.eglInitialize(display, &major, &minor), "eglInitialize"))
+            {
+                s_display_refs.erase(display);
+                return EGL_NO_DISPLAY;
+            }
+        }
+
+        refs++;
+        return display;
+    }
+
+    static void release_display(EGLDisplay display)
+    {
+        std::lock_guard<std::mutex> lock(s_display_mutex);
+
+        auto iter = s_display_refs.find(display);
+        assert(iter != s_display_refs.end());
+        if (iter != s_display_refs.end() && --iter->second == 0)
+        {
+            s_egl_funcs.eglTerminate(display);
+            s_display_refs.erase(iter);
+        }
+    }
+
+    static bool initialize_egl_context(EGLDisplay display, GLShareGroup* group, const ContextConfig& context_config, ::EGLContext* context, EGLSurface* surface, EGLConfig* config)
     {
         std::vector<EGLint> attribs;
 
@@ -151,22 +283,28 @@ namespace GL
         attribs.push_back(EGL_BLUE_SIZE);
         attribs.push_back(8);
 
+        // a surfaceless context never binds a pbuffer, so any surface type will do
+        bool surfaceless = context_config.surfaceless && has_egl_extension(display, "EGL_KHR_surfaceless_context");
+
         if (context_config.need_alpha)
         {
             attribs.push_back(EGL_ALPHA_SIZE);
             attribs.push_back(8);
 
-            attribs.push_back(EGL_BIND_TO_TEXTURE_RGBA);
-            attribs.push_back(EGL_TRUE);
+            if (!surfaceless)
+            {
+                attribs.push_back(EGL_BIND_TO_TEXTURE_RGBA);
+                attribs.push_back(EGL_TRUE);
+            }
         }
-        else
+        else if (!surfaceless)
         {
             attribs.push_back(EGL_BIND_TO_TEXTURE_RGB);
             attribs.push_back(EGL_TRUE);
         }
 
         attribs.push_back(EGL_SURFACE_TYPE);
-        attribs.push_back(EGL_PBUFFER_BIT);
+        attribs.push_back(surfaceless ? 0 : EGL_PBUFFER_BIT);
 
         attribs.push_back(EGL_RENDERABLE_TYPE);
         if (context_config.major_version >= 3)
@@ -179,18 +317,29 @@ namespace GL
         EGLint num_config;
         EGL_CHK_AND_RET_FALSE(s_egl_funcs.eglChooseConfig(display, attribs.data(), nullptr, 0, &num_config));
 
+        EGL_CHK_AND_RET_FALSE(num_config > 0);
+
         std::vector<EGLConfig> configs(num_config);
         EGL_CHK_AND_RET_FALSE(s_egl_funcs.eglChooseConfig(display, attribs.data(), configs.data(), num_config, &num_config));
-        *config = configs[1];
 
-        static const EGLint pb_attrib_list[] = {
-            EGL_WIDTH, 1,
-            EGL_HEIGHT, 1,
-            EGL_NONE,
-        };
+        if (surfaceless)
+        {
+            *config = configs[0];
+            *surface = EGL_NO_SURFACE;
+        }
+        else
+        {
+            *config = configs[num_config > 1 ? 1 : 0];
+
+            static const EGLint pb_attrib_list[] = {
+                EGL_WIDTH, 1,
+                EGL_HEIGHT, 1,
+                EGL_NONE,
+            };
 
-        *surface = s_egl_funcs.eglCreatePbufferSurface(display, *config, pb_attrib_list);
-        EGL_CHK_AND_RET_FALSE(*surface != nullptr);
+            *surface = s_egl_funcs.eglCreatePbufferSurface(display, *config, pb_attrib_list);
+            EGL_CHK_AND_RET_FALSE(*surface != nullptr);
+        }
 
         EGLint attrib_list[] = {
             EGL_CONTEXT_MAJOR_VERSION, context_config.major_version,
@@ -198,15 +347,13 @@ namespace GL
             EGL_NONE
         };
 
-        if (shared)
+        if (group)
         {
-            *context = s_egl_funcs.eglCreateContext(display, *config, s_shared_context, attrib_list);
+            *context = group->join([&](void* shared_context)
+            {
+                return s_egl_funcs.eglCreateContext(display, *config, shared_context, attrib_list);
+            });
             EGL_CHK_AND_RET_FALSE(*context != nullptr);
-
-            if (s_shared_context == nullptr)
-                s_shared_context = *context;
-
-            s_shared_count++;
         }
         else
         {
@@ -214,13 +361,22 @@ namespace GL
             EGL_CHK_AND_RET_FALSE(*context != nullptr);
         }
 
-        EGL_CHK_AND_RET_FALSE(s_egl_funcs.eglMakeCurrent(display, *surface, *surface, *context));
+        if (!error_chk(s_egl_funcs.eglMakeCurrent(display, *surface, *surface, *context), "eglMakeCurrent"))
+        {
+            // don't leave a dead member behind for later contexts to share from
+            if (group)
+                group->leave(*context);
+
+            s_egl_funcs.eglDestroyContext(display, *context);
+            *context = nullptr;
+            return false;
+        }
 
         return true;
     }
 
 
-    EGLContext::EGLContext(bool shared) : GLContext(shared) {}
+    EGLContext::EGLContext(GLShareGroup* share_group, int device) : GLContext(share_group), m_device(device) {}
 
     EGLContext::~EGLContext()
     {
@@ -231,15 +387,9 @@ namespace GL
                 if (m_context == s_egl_funcs.eglGetCurrentContext())
                     s_egl_funcs.eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, nullptr);
 
-                if (m_is_shared && (m_context != s_shared_context || s_shared_count == 1))
-                {
-                    assert(s_shared_count > 0);
-
-                    s_shared_count--;
+                if (m_share_group)
+                    m_share_group->leave(m_context);
 
-                    if (s_shared_count == 0)
-                        s_shared_context = nullptr;
-                }
                 s_egl_funcs.eglDestroyContext(m_display, m_context);
                 m_context = nullptr;
             }
@@ -250,7 +400,7 @@ namespace GL
                 m_surface = EGL_NO_SURFACE;
             }
 
-            s_egl_funcs.eglTerminate(m_display);
+            release_display(m_display);
             m_display = EGL_NO_DISPLAY;
         }
     }
@@ -262,20 +412,34 @@ namespace GL
         EGLSurface prev_read_surface = s_egl_funcs.eglGetCurrentSurface(EGL_READ);
         ::EGLContext prev_context = s_egl_funcs.eglGetCurrentContext();
 
-        m_display = s_egl_funcs.eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        if (m_device >= 0)
+        {
+            std::vector<EGLDeviceEXT> devices = query_devices();
+            EGL_CHK_AND_RET_FALSE(m_device < static_cast<int>(devices.size()) && has_egl_extension(EGL_NO_DISPLAY, "EGL_EXT_platform_device"));
+
+            m_software = device_is_software(devices[m_device]);
+            m_display = acquire_display(get_platform_display(EGL_PLATFORM_DEVICE_EXT, devices[m_device]));
+        }
+        else
+        {
+            m_display = acquire_display(s_egl_funcs.eglGetDisplay(EGL_DEFAULT_DISPLAY));
+#if defined(__linux__)
+            // no window system on headless servers, mesa can still render without one
+            if (m_display == EGL_NO_DISPLAY && has_egl_extension(EGL_NO_DISPLAY, "EGL_MESA_platform_surfaceless"))
+                m_display = acquire_display(get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY));
+#endif
+        }
         EGL_CHK_AND_RET_FALSE(m_display != EGL_NO_DISPLAY);
 
-        EGLint major, minor;
-        EGL_CHK_AND_RET_FALSE(s_egl_funcs.eglInitialize(m_display, &major, &minor));
         EGL_CHK_AND_RET_FALSE(s_egl_funcs.eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, nullptr));
         EGL_CHK_AND_RET_FALSE(s_egl_funcs.eglBindAPI(EGL_OPENGL_ES_API));
 
         ContextConfig config;
         while (true)
         {
-            if (initialize_egl_context(m_display, m_is_shared, config, &m_context, &m_surface, &m_config))
+            if (initialize_egl_context(m_display, m_share_group, config, &m_context, &m_surface, &m_config))
             {
-                load_gl_es_functions(reinterpret_cast<void**>(&m_func), reinterpret_cast<void**>(&m_ext_func));
+                load_gl_es_functions(&m_func, &m_ext_func, &m_extensions);
                 break;
             }
 
@@ -294,10 +458,14 @@ namespace GL
 
         if (m_func)
         {
-            m_func->glClearColor(0.294, 0.294, 0.294, 0.000);
-            m_func->glClear(GL_COLOR_BUFFER_BIT);
-            m_func->glClearColor(0.000, 0.000, 0.000, 0.000);
-            EGL_CHK_AND_RET_FALSE(s_egl_funcs.eglSwapBuffers(m_display, m_surface));
+            // a surfaceless context has no default framebuffer to clear or swap
+            if (m_surface != EGL_NO_SURFACE)
+            {
+                m_func->glClearColor(0.294, 0.294, 0.294, 0.000);
+                m_func->glClear(GL_COLOR_BUFFER_BIT);
+                m_func->glClearColor(0.000, 0.000, 0.000, 0.000);
+                EGL_CHK_AND_RET_FALSE(s_egl_funcs.eglSwapBuffers(m_display, m_surface));
+            }
 
             if (prev_display != EGL_NO_DISPLAY)
                 EGL_CHK(s_egl_funcs.eglMakeCurrent(prev_display, prev_draw_surface, prev_read_surface, prev_context));
@@ -314,16 +482,24 @@ namespace GL
         return GLESBackend::direct3d_11;
 #elif defined(__APPLE__)
         return GLESBackend::metal;
+#else
+        // mesa implements gles natively on linux
+        return m_software ? GLESBackend::software : GLESBackend::gl_es;
 #endif
     }
 
-    bool EGLContext::activate() const
+    int EGLContext::device() const
+    {
+        return m_device;
+    }
+
+    bool EGLContext::make_current() const
     {
         EGL_CHK_AND_RET_FALSE(s_egl_funcs.eglMakeCurrent(m_display, m_surface, m_surface, m_context));
         return true;
     }
 
-    bool EGLContext::release() const
+    bool EGLContext::clear_current() const
     {
         EGL_CHK_AND_RET_FALSE(s_egl_funcs.eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, nullptr));
         return true;
@@ -331,6 +507,9 @@ namespace GL
 
     bool EGLContext::swap_buffers() const
     {
+        if (m_surface == EGL_NO_SURFACE)
+            return true;
+
         EGL_CHK_AND_RET_FALSE(s_egl_funcs.eglSwapBuffers(m_display, m_surface));
         return true;
     }
@@ -341,11 +520,11 @@ namespace GL
     }
 
 
-    GLContext* create_egl_offscreen_context(bool shared)
+    GLContext* create_egl_offscreen_context(GLShareGroup* group, int device)
     {
         s_egl_funcs.initialize();
 
-        EGLContext* context = new EGLContext(shared);
+        EGLContext* context = new EGLContext(group, device);
         if (!context->initialize())
         {
             delete context;
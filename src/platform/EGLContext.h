@@ -22,6 +22,7 @@ namespace GL
         gl_es,
         vulkan,
         metal,
+        software,
     };
 
     class GLTexture;
@@ -29,21 +30,26 @@ namespace GL
     class EGLContext final : public GLContext
     {
     public:
-        explicit EGLContext(bool shared);
+        // device is an index from enumerate_egl_devices, -1 for the default display
+        EGLContext(GLShareGroup* share_group, int device);
         ~EGLContext() override;
 
         bool initialize();
         [[nodiscard]] GLESBackend backend() const;
+        [[nodiscard]] int device() const;
 
-        bool activate() const override;
-        bool release() const override;
         bool swap_buffers() const override;
         bool is_opengl_es() const override;
+    protected:
+        bool make_current() const override;
+        bool clear_current() const override;
     private:
         EGLDisplay      m_display = nullptr;
         EGLSurface      m_surface = nullptr;
         ::EGLContext    m_context = nullptr;
         EGLConfig       m_config = nullptr;
+        int             m_device = -1;
+        bool            m_software = false;
 
         friend class GLTexture;
     };
@@ -75,6 +81,10 @@ namespace GL
         PFNEGLGETPLATFORMDISPLAYPROC                eglGetPlatformDisplay               = nullptr;
         PFNEGLQUERYDEVICEATTRIBEXTPROC              eglQueryDeviceAttribEXT             = nullptr;
         PFNEGLCREATEIMAGEKHRPROC                    eglCreateImageKHR                   = nullptr;
+        // extensions, resolved through eglGetProcAddress
+        PFNEGLGETPLATFORMDISPLAYEXTPROC             eglGetPlatformDisplayEXT            = nullptr;
+        PFNEGLQUERYDEVICESEXTPROC                   eglQueryDevicesEXT                  = nullptr;
+        PFNEGLQUERYDEVICESTRINGEXTPROC              eglQueryDeviceStringEXT             = nullptr;
 
         void initialize();
     private:
@@ -3,9 +3,13 @@
 //
 #pragma once
 
+#include <vector>
+
 namespace GL
 {
     class GLContext;
+    class GLShareGroup;
+    struct GLDevice;
 
     struct ContextConfig
     {
@@ -16,6 +20,14 @@ namespace GL
 
         // all
         bool need_alpha = true;
+
+        // egl, bind without any surface when EGL_KHR_surfaceless_context is available.
+        // d3d11 interop needs a pbuffer capable config, so keep the pbuffer there
+#if defined(_WIN32)
+        bool surfaceless = false;
+#else
+        bool surfaceless = true;
+#endif
 #if defined(_WIN32) && !defined(GL_ES)
         int major_version = 4;
         int minor_version = 6;
@@ -27,8 +39,9 @@ namespace GL
 
 #ifdef _WIN32
     // only valid in hardware rendering
-    GLContext* create_wgl_offscreen_context(bool shared);
+    GLContext* create_wgl_offscreen_context(GLShareGroup* group);
 #endif
-    // valid in hardware and software rendering
-    GLContext* create_egl_offscreen_context(bool shared);
+    // valid in hardware and software rendering, device is an index from enumerate_egl_devices or -1
+    GLContext* create_egl_offscreen_context(GLShareGroup* group, int device = -1);
+    std::vector<GLDevice> enumerate_egl_devices();
 }
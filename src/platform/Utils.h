@@ -7,6 +7,9 @@
 #include <cassert>
 #include <vector>
 #include <algorithm>
+#include <string>
+#include <string_view>
+#include <unordered_set>
 
 namespace GL
 {
@@ -19,6 +22,37 @@ namespace GL
         return expr;
     }
 
-    void load_gl_functions(void** func, void** ext_func);
-    void load_gl_es_functions(void** func, void** ext_func);
+    struct GLFunctions;
+    struct GLExtFunctions;
+
+    struct ExtensionHash
+    {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view name) const
+        {
+            return std::hash<std::string_view>{}(name);
+        }
+    };
+
+    // extension names reported by the driver, built once with the function table
+    struct GLExtensions
+    {
+        std::unordered_set<std::string, ExtensionHash, std::equal_to<>> names;
+
+        [[nodiscard]] bool contains(std::string_view name) const
+        {
+            return names.find(name) != names.end();
+        }
+    };
+
+    // parses GL_VERSION of the current context, false when the driver reports none
+    bool query_version(GLFunctions const* func, int* major, int* minor);
+
+    // lazy tables resolve each entry point on its first call, takes effect for contexts created afterwards
+    void set_lazy_loading(bool lazy);
+
+    // returned tables are cached per (api, version, driver) and owned by the loader
+    void load_gl_functions(GLFunctions const** func, GLExtFunctions const** ext_func, GLExtensions const** exts);
+    void load_gl_es_functions(GLFunctions const** func, GLExtFunctions const** ext_func, GLExtensions const** exts);
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 //
 
 #include <GLFunctions.h>
+#include <GLShareGroup.h>
 
 #include "WGLContext.h"
 #include "PlatformGLContext.h"
@@ -17,10 +18,6 @@ namespace GL
 #else
 #define WIN32_CHK_AND_RET(expr) if (!(expr)) { return; }
 #endif
-    // fork from blender
-    static HGLRC s_shared_hglrc = nullptr;
-    static int s_shared_count = 0;
-
     WGLFunctions s_wgl_funcs;
 
     void WGLFunctions::initialize()
@@ -356,7 +353,7 @@ namespace GL
         return iPixelFormat;
     }
 
-    static HGLRC initialize_wgl_context(HWND hWnd, HDC hdc, bool shared, const ContextConfig& config)
+    static HGLRC initialize_wgl_context(HWND hWnd, HDC hdc, GLShareGroup* group, const ContextConfig& config)
     {
         bool result = false;
         HGLRC hglrc = nullptr;
@@ -447,25 +444,22 @@ namespace GL
         if (result)
             return hglrc;
 
-        if (shared)
+        if (group)
         {
-            s_shared_count++;
-
-            if (s_shared_hglrc == nullptr)
-                s_shared_hglrc = hglrc;
-            else
+            void* joined = group->join([&](void* shared_hglrc) -> void*
             {
-                result = !WIN32_CHK(s_wgl_funcs.wglShareLists(s_shared_hglrc, hglrc));
-                if (result)
-                {
-                    s_shared_count--;
+                if (shared_hglrc != nullptr && !error_chk(s_wgl_funcs.wglShareLists((HGLRC)shared_hglrc, hglrc), "wglShareLists"))
+                    return nullptr;
+                return hglrc;
+            });
 
-                    if (hglrc == s_wgl_funcs.wglGetCurrentContext())
-                        WIN32_CHK(s_wgl_funcs.wglMakeCurrent(nullptr, nullptr));
+            if (joined == nullptr)
+            {
+                if (hglrc == s_wgl_funcs.wglGetCurrentContext())
+                    WIN32_CHK(s_wgl_funcs.wglMakeCurrent(nullptr, nullptr));
 
-                    WIN32_CHK(s_wgl_funcs.wglDeleteContext(hglrc));
-                    return nullptr;
-                }
+                WIN32_CHK(s_wgl_funcs.wglDeleteContext(hglrc));
+                return nullptr;
             }
         }
 
@@ -475,7 +469,7 @@ namespace GL
     }
 
 
-    WGLContext::WGLContext(HWND hwnd, HDC hdc, bool shared) : GLContext(shared), m_hwnd(hwnd), m_hdc(hdc), m_hglrc(nullptr)
+    WGLContext::WGLContext(HWND hwnd, HDC hdc, GLShareGroup* share_group) : GLContext(share_group), m_hwnd(hwnd), m_hdc(hdc), m_hglrc(nullptr)
     {
         assert(m_hdc != nullptr);
     }
@@ -487,15 +481,9 @@ namespace GL
             if (m_hglrc == s_wgl_funcs.wglGetCurrentContext())
                 WIN32_CHK(s_wgl_funcs.wglMakeCurrent(nullptr, nullptr));
 
-            if (m_is_shared && (m_hglrc != s_shared_hglrc || s_shared_count == 1))
-            {
-                assert(s_shared_count > 0);
-
-                s_shared_count--;
+            if (m_share_group)
+                m_share_group->leave(m_hglrc);
 
-                if (s_shared_count == 0)
-                    s_shared_hglrc = nullptr;
-            }
             WIN32_CHK(s_wgl_funcs.wglDeleteContext(m_hglrc));
             m_hglrc = nullptr;
         }
@@ -514,10 +502,10 @@ namespace GL
         ContextConfig config;
         while (true)
         {
-            m_hglrc = initialize_wgl_context(m_hwnd, m_hdc, m_is_shared, config);
+            m_hglrc = initialize_wgl_context(m_hwnd, m_hdc, m_share_group, config);
             if (m_hglrc)
             {
-                load_gl_functions(reinterpret_cast<void**>(&m_func), reinterpret_cast<void**>(&m_ext_func));
+                load_gl_functions(&m_func, &m_ext_func, &m_extensions);
                 break;
             }
             else
@@ -548,13 +536,13 @@ namespace GL
         return false;
     }
 
-    bool WGLContext::activate() const
+    bool WGLContext::make_current() const
     {
         bool result = WIN32_CHK(s_wgl_funcs.wglMakeCurrent(m_hdc, m_hglrc));
         return result;
     }
 
-    bool WGLContext::release() const
+    bool WGLContext::clear_current() const
     {
         bool result = WIN32_CHK(s_wgl_funcs.wglMakeCurrent(nullptr, nullptr));
         return result;
@@ -572,7 +560,7 @@ namespace GL
     }
 
 
-    GLContext* create_wgl_offscreen_context(bool shared)
+    GLContext* create_wgl_offscreen_context(GLShareGroup* group)
     {
         /* OpenGL needs a dummy window to create a context on windows. */
         HWND wnd = CreateWindowA("Static",
@@ -591,7 +579,7 @@ namespace GL
 
         s_wgl_funcs.initialize();
 
-        WGLContext* context = new WGLContext(wnd, hdc, shared);
+        WGLContext* context = new WGLContext(wnd, hdc, group);
         if (!context->initialize())
         {
             delete context;
@@ -13,14 +13,15 @@ namespace GL
     class WGLContext final : public GLContext
     {
     public:
-        WGLContext(HWND hwnd, HDC hdc, bool shared);
+        WGLContext(HWND hwnd, HDC hdc, GLShareGroup* share_group);
         ~WGLContext() override;
 
         bool initialize();
-        bool activate() const override;
-        bool release() const override;
         bool swap_buffers() const override;
         bool is_opengl_es() const override;
+    protected:
+        bool make_current() const override;
+        bool clear_current() const override;
     private:
         HWND m_hwnd;
         HDC m_hdc;
@@ -0,0 +1,276 @@
+#include <GLCommandBuffer.h>
+#include <GLContext.h>
+#include <GLFunctions.h>
+#include <GLProgram.h>
+#include <GLReadbackQueue.h>
+#include <GLTexture.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+// producers own no context, every gl call they need goes through the queue
+static constexpr int Producer_Count = 4;
+static constexpr int Frame_Count = 16;
+static constexpr int Width = 256;
+static constexpr int Height = 256;
+static constexpr int Group_Size = 16;
+
+static auto VertexShader = R"(
+layout (location = 0) in vec3 a_position;
+layout (location = 1) in vec2 a_coord;
+out vec2 v_coord;
+
+void main()
+{
+    v_coord = a_coord;
+    gl_Position = vec4(a_position, 1.0);
+}
+)";
+
+// black unless the recorded uniform reached the program
+static auto FragmentShader = R"(
+uniform sampler2D s_texture;
+uniform float u_mix;
+in vec2 v_coord;
+out vec4 color;
+
+void main()
+{
+    color = texture(s_texture, v_coord) * u_mix;
+}
+)";
+
+static auto ComputeShader = R"(
+layout (local_size_x = 16, local_size_y = 16) in;
+
+layout (rgba8, binding = 0) uniform readonly highp image2D u_source;
+layout (rgba8, binding = 1) uniform writeonly highp image2D u_target;
+
+void main()
+{
+    ivec2 coord = ivec2(gl_GlobalInvocationID.xy);
+    vec4 color = imageLoad(u_source, coord);
+    imageStore(u_target, coord, vec4(1.0 - color.rgb, color.a));
+}
+)";
+
+struct Producer
+{
+    GL::GLTexture*          source      = nullptr;
+    // drawn with draw, then copied with draw_arrays
+    GL::GLTexture*          target      = nullptr;
+    GL::GLTexture*          copy        = nullptr;
+    // created and deleted on the queue context
+    GL::GLReadbackQueue*    readback    = nullptr;
+    std::vector<uint8_t>    expected;
+    std::vector<uint8_t>    pixels;
+    std::vector<uint8_t>    copy_pixels;
+    size_t                  mismatches  = 0;
+};
+
+// the quad maps the top of the texture to the bottom of the target, rows come back flipped
+static size_t count_mismatches(std::vector<uint8_t> const& pixels, size_t stride, std::vector<uint8_t> const& expected)
+{
+    size_t mismatches = 0;
+    size_t row = static_cast<size_t>(Width) * 4;
+    for (size_t y = 0; y < Height; y++)
+    {
+        for (size_t x = 0; x < row; x++)
+        {
+            if (std::abs(pixels[y * stride + x] - expected[(Height - 1 - y) * row + x]) > 1)
+                mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+int main()
+{
+    GL::GLContext* context = GL::create_offscreen_context(true);
+    context->activate();
+
+    GL::GLCommandQueue* queue = new GL::GLCommandQueue();
+    if (queue->context() == nullptr)
+    {
+        std::cout << "failed to create queue context" << std::endl;
+        return 1;
+    }
+
+    std::string header = context->is_opengl_es() ? "#version 300 es\nprecision highp float;\n" : "#version 330\n";
+
+    // programs are shared, unlike the framebuffers and vertex arrays the queue makes for itself
+    GL::GLProgram* program = new GL::GLProgram();
+    program->attach_shader(GL::ShaderType::Vertex, (header + VertexShader).c_str());
+    program->attach_shader(GL::ShaderType::Fragment, (header + FragmentShader).c_str());
+    if (!program->link())
+    {
+        std::cout << "failed to link program" << std::endl;
+        return 1;
+    }
+    GL::UniformHandle<float> mix = program->uniform<float>("u_mix");
+
+    std::vector<Producer> producers(Producer_Count);
+    for (auto& producer : producers)
+    {
+        producer.source = new GL::GLTexture(Width, Height, GL_RGBA8, GL_RGBA, context);
+        producer.source->set_filter(GL_NEAREST, GL_NEAREST);
+        producer.target = new GL::GLTexture(Width, Height, GL_RGBA8, GL_RGBA, context);
+        producer.target->set_filter(GL_NEAREST, GL_NEAREST);
+        producer.copy = new GL::GLTexture(Width, Height, GL_RGBA8, GL_RGBA, context);
+        producer.expected.resize(static_cast<size_t>(Width) * Height * 4);
+        producer.copy_pixels.resize(producer.expected.size());
+    }
+    // the queue context must see the storage before any upload lands in it
+    context->get_func()->glFinish();
+
+    {
+        GL::GLCommandBuffer setup = queue->acquire();
+        setup.record([&producers](GL::GLContext* current)
+        {
+            for (auto& producer : producers)
+                producer.readback = new GL::GLReadbackQueue(Width, Height, GL_RGBA, GL_UNSIGNED_BYTE, 2, current);
+        });
+        queue->wait(queue->submit(std::move(setup)));
+    }
+
+    std::atomic<uint64_t> commands = 0;
+    std::vector<std::thread> threads;
+    for (int index = 0; index < Producer_Count; index++)
+    {
+        threads.emplace_back([&, index]
+        {
+            Producer& producer = producers[index];
+            std::vector<uint8_t> image(producer.expected.size());
+
+            for (int frame = 0; frame < Frame_Count; frame++)
+            {
+                for (size_t i = 0; i < image.size(); i++)
+                    image[i] = static_cast<uint8_t>(i / 4 + index * 31 + frame * 7 + i % 4);
+                producer.expected = image;
+
+                GL::GLCommandBuffer buffer = queue->acquire();
+                buffer.upload(producer.source, std::as_bytes(std::span(image)), GL_RGBA, GL_UNSIGNED_BYTE);
+
+                buffer.bind_framebuffer(producer.target);
+                buffer.use_program(program);
+                buffer.set_uniform(mix, 1.0f);
+                buffer.bind_texture(0, producer.source);
+                buffer.draw(GL::MeshType::quad);
+                buffer.readback(producer.readback);
+                buffer.record([&producer](GL::GLContext*)
+                {
+                    std::optional<GL::GLReadbackQueue::Frame> result = producer.readback->dequeue();
+                    if (!result)
+                    {
+                        producer.mismatches++;
+                        return;
+                    }
+                    producer.pixels.assign(result->data().begin(), result->data().end());
+                    producer.mismatches += count_mismatches(producer.pixels, result->stride(), producer.expected);
+                });
+
+                // the quad's vertex array stays bound after draw
+                buffer.bind_framebuffer(producer.copy);
+                buffer.draw_arrays(GL_TRIANGLE_STRIP, 0, 4);
+                buffer.record([&producer](GL::GLContext* current)
+                {
+                    current->get_func()->glReadPixels(0, 0, Width, Height, GL_RGBA, GL_UNSIGNED_BYTE, producer.copy_pixels.data());
+                    producer.mismatches += count_mismatches(producer.copy_pixels, static_cast<size_t>(Width) * 4, producer.expected);
+                });
+                buffer.bind_texture(0, nullptr);
+                buffer.bind_framebuffer(nullptr);
+
+                commands += buffer.command_count();
+                uint64_t ticket = queue->submit(std::move(buffer));
+
+                // the recorded copy is what gets uploaded, the source can change before the replay
+                std::memset(image.data(), 0xAA, image.size());
+                queue->wait(ticket);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+    queue->wait_idle();
+
+    size_t mismatches = 0;
+    for (auto& producer : producers)
+        mismatches += producer.mismatches;
+
+    // compute needs es 3.1 / gl 4.3, the dispatch is skipped on older contexts
+    std::string compute_header = context->is_opengl_es() ? "#version 310 es\n" : "#version 430\n";
+    GL::GLProgram* compute = new GL::GLProgram();
+    compute->attach_shader(GL::ShaderType::Compute, (compute_header + ComputeShader).c_str());
+    if (compute->link())
+    {
+        Producer& producer = producers[0];
+        GL::GLTexture* inverted = new GL::GLTexture(Width, Height, GL_RGBA8, GL_RGBA, context);
+        context->get_func()->glFinish();
+
+        GL::GLCommandBuffer buffer = queue->acquire();
+        buffer.record([&producer, inverted](GL::GLContext*)
+        {
+            producer.source->bind_image(0, GL_READ_ONLY);
+            inverted->bind_image(1, GL_WRITE_ONLY);
+        });
+        buffer.dispatch(compute, Width / Group_Size, Height / Group_Size, 1, GL_FRAMEBUFFER_BARRIER_BIT);
+        buffer.bind_framebuffer(inverted);
+        buffer.record([&producer](GL::GLContext* current)
+        {
+            current->get_func()->glReadPixels(0, 0, Width, Height, GL_RGBA, GL_UNSIGNED_BYTE, producer.copy_pixels.data());
+        });
+        buffer.bind_framebuffer(nullptr);
+        queue->wait(queue->submit(std::move(buffer)));
+
+        size_t inversions = 0;
+        for (size_t i = 0; i < producer.copy_pixels.size(); i++)
+        {
+            int expected = i % 4 == 3 ? producer.expected[i] : 255 - producer.expected[i];
+            if (std::abs(producer.copy_pixels[i] - expected) > 1)
+                inversions++;
+        }
+        std::cout << "mismatched dispatch channels: " << inversions << std::endl;
+        mismatches += inversions;
+
+        delete inverted;
+    }
+    else
+        std::cout << "compute unsupported, skipping dispatch" << std::endl;
+
+    {
+        GL::GLCommandBuffer teardown = queue->acquire();
+        teardown.record([&producers](GL::GLContext*)
+        {
+            for (auto& producer : producers)
+                delete producer.readback;
+        });
+        queue->wait(queue->submit(std::move(teardown)));
+    }
+
+    std::cout << "replayed commands: " << commands << std::endl;
+    std::cout << "mismatched channels: " << mismatches << std::endl;
+
+    delete queue;
+    for (auto& producer : producers)
+    {
+        delete producer.source;
+        delete producer.target;
+        delete producer.copy;
+    }
+    delete compute;
+    delete program;
+
+    context->release();
+    GL::destroy_context(context);
+
+    return mismatches == 0 ? 0 : 1;
+}
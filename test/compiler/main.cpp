@@ -0,0 +1,138 @@
+#include <GLContext.h>
+#include <GLProgram.h>
+#include <GLProgramCompiler.h>
+
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+static constexpr size_t Program_Count = 24;
+static constexpr size_t Worker_Count = 4;
+
+static auto VertexShader = R"(
+void main()
+{
+    gl_Position = vec4(0.0, 0.0, 0.0, 1.0);
+}
+)";
+
+// every program differs by the constant, so the driver can't merge the compiles
+static auto FragmentShader = R"(
+uniform float u_scale;
+uniform vec3 u_tint;
+out vec4 color;
+
+void main()
+{
+    color = vec4(u_tint * u_scale * CONSTANT, 1.0);
+}
+)";
+
+static auto BrokenShader = R"(
+out vec4 color;
+
+void main()
+{
+    color = undeclared;
+}
+)";
+
+// links Program_Count good programs and a broken one, returns the number of wrong results
+static size_t compile_all(GL::GLProgramCompiler& compiler, std::string const& header)
+{
+    std::vector<GL::GLProgram*> programs;
+    std::vector<GL::GLProgramCompiler::Pending> pending;
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (size_t i = 0; i <= Program_Count; i++)
+    {
+        bool broken = i == Program_Count;
+        std::string fragment = header + "#define CONSTANT " + std::to_string(i + 1) + ".0\n" + (broken ? BrokenShader : FragmentShader);
+
+        auto program = new GL::GLProgram();
+        program->attach_shader(GL::ShaderType::Vertex, (header + VertexShader).c_str());
+        program->attach_shader(GL::ShaderType::Fragment, fragment.c_str());
+
+        programs.push_back(program);
+        pending.push_back(compiler.submit(program));
+    }
+
+    size_t failed = 0;
+    for (size_t i = 0; i < pending.size(); i++)
+    {
+        bool linked = pending[i].wait();
+        if (i == Program_Count)
+        {
+            if (linked)
+                failed++;
+            continue;
+        }
+
+        if (!linked)
+        {
+            failed++;
+            continue;
+        }
+
+        // uniforms are collected on this context even when a worker linked
+        GL::GLProgram* program = programs[i];
+        if (program->uniform_location("u_scale") < 0 || program->uniform_location("u_tint") < 0)
+            failed++;
+        if (!program->uniform<float>("u_scale").valid() || !program->uniform<std::array<float, 3>>("u_tint").valid())
+            failed++;
+        if (program->uniform<int32_t>("u_scale").valid())
+            failed++;
+
+        program->use();
+        program->set_uniform_value("u_scale", 0.5f);
+        program->set_uniform_value("u_tint", 1.0f, 0.5f, 0.25f);
+        program->release();
+    }
+
+    std::chrono::duration<double, std::milli> diff = std::chrono::high_resolution_clock::now() - start;
+    std::cout << "parallel: " << compiler.is_parallel() << ", workers: " << compiler.worker_count()
+              << ", " << pending.size() << " programs in " << diff.count() << " ms" << std::endl;
+
+    for (auto program : programs)
+        delete program;
+
+    return failed;
+}
+
+int main()
+{
+    GL::GLContext* context = GL::create_offscreen_context();
+    context->activate();
+
+    std::string header = context->is_opengl_es() ? "#version 300 es\nprecision highp float;\n" : "#version 330\n";
+
+    size_t failed = 0;
+
+    if (context->has_extension("GL_KHR_parallel_shader_compile"))
+    {
+        GL::GLProgramCompiler compiler(Worker_Count, context);
+        if (!compiler.is_parallel() || compiler.worker_count() != 0)
+            failed++;
+        failed += compile_all(compiler, header);
+    }
+    else
+        std::cout << "GL_KHR_parallel_shader_compile unsupported, skipping the driver path" << std::endl;
+
+    {
+        // worker threads on contexts of the default share group
+        GL::GLProgramCompiler compiler(Worker_Count, context, false);
+        if (compiler.is_parallel() || compiler.worker_count() == 0)
+            failed++;
+        failed += compile_all(compiler, header);
+    }
+
+    std::cout << "failed: " << failed << std::endl;
+
+    context->release();
+    GL::destroy_context(context);
+
+    return failed == 0 ? 0 : 1;
+}
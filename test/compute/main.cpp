@@ -0,0 +1,106 @@
+#include <GLContext.h>
+#include <GLFramebuffer.h>
+#include <GLFunctions.h>
+#include <GLProgram.h>
+#include <GLTexture.h>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// inverts the color channels, written straight to the output image without rasterizing
+static auto ComputeShader = R"(
+layout (local_size_x = 16, local_size_y = 16) in;
+
+layout (rgba8, binding = 0) uniform readonly highp image2D u_source;
+layout (rgba8, binding = 1) uniform writeonly highp image2D u_target;
+
+void main()
+{
+    ivec2 coord = ivec2(gl_GlobalInvocationID.xy);
+    if (any(greaterThanEqual(coord, imageSize(u_source))))
+        return;
+
+    vec4 color = imageLoad(u_source, coord);
+    imageStore(u_target, coord, vec4(1.0 - color.rgb, color.a));
+}
+)";
+
+int main()
+{
+    GL::GLContext* context = GL::create_offscreen_context(false);
+    context->activate();
+
+    auto func = context->get_func();
+
+    int width, height, channels;
+    uint8_t* image = stbi_load(ASSETS_DIR"a.png", &width, &height, &channels, STBI_rgb_alpha);
+
+    GL::GLTexture* source = new GL::GLTexture(width, height, GL_RGBA8, GL_RGBA);
+    source->upload(image, GL_RGBA, GL_UNSIGNED_BYTE);
+    GL::GLTexture* target = new GL::GLTexture(width, height, GL_RGBA8, GL_RGBA);
+
+    std::string header = context->is_opengl_es() ? "#version 310 es\n" : "#version 430\n";
+
+    GL::GLProgram* program = new GL::GLProgram();
+    program->attach_shader(GL::ShaderType::Compute, (header + ComputeShader).c_str());
+    if (!program->link())
+    {
+        std::cout << "failed to link compute program" << std::endl;
+        return 1;
+    }
+
+    auto size = program->work_group_size();
+    std::cout << "work group size: " << size[0] << " x " << size[1] << " x " << size[2] << std::endl;
+
+    source->bind_image(0, GL_READ_ONLY);
+    target->bind_image(1, GL_WRITE_ONLY);
+
+    program->use();
+    // the result is read back through a framebuffer next
+    program->dispatch_threads(width, height, 1, GL_FRAMEBUFFER_BARRIER_BIT);
+    program->release();
+
+    GL::GLFramebuffer* framebuffer = new GL::GLFramebuffer();
+    framebuffer->attach_color(0, *target);
+    if (!framebuffer->validate())
+    {
+        std::cout << "incomplete framebuffer" << std::endl;
+        return 1;
+    }
+
+    std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+    framebuffer->bind();
+    func->glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    framebuffer->unbind();
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < pixels.size(); i++)
+    {
+        int expected = i % 4 == 3 ? image[i] : 255 - image[i];
+        if (std::abs(pixels[i] - expected) > 1)
+            mismatches++;
+    }
+    std::cout << "mismatched channels: " << mismatches << std::endl;
+
+    stbi_write_png("compute.png", width, height, 4, pixels.data(), 0);
+
+    delete framebuffer;
+    delete program;
+    delete target;
+    delete source;
+
+    stbi_image_free(image);
+
+    context->release();
+    GL::destroy_context(context);
+
+    return mismatches == 0 ? 0 : 1;
+}
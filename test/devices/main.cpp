@@ -0,0 +1,73 @@
+#include <GLContext.h>
+#include <GLDevice.h>
+#include <GLFunctions.h>
+
+#include <iostream>
+#include <vector>
+
+int main()
+{
+    std::vector<GL::GLDevice> devices = GL::enumerate_devices();
+    std::cout << "devices: " << devices.size() << std::endl;
+    if (devices.empty())
+    {
+        std::cout << "no device enumeration, skipping" << std::endl;
+        return 0;
+    }
+
+    int created = 0;
+    int failed = 0;
+    for (auto& device : devices)
+    {
+        std::cout << "device " << device.index << ": drm " << (device.drm_device.empty() ? "-" : device.drm_device)
+                  << ", render node " << (device.render_node.empty() ? "-" : device.render_node)
+                  << ", software " << device.software << std::endl;
+
+        // a device may expose no gles driver at all, only the ones that do are checked
+        GL::GLContext* context = GL::create_offscreen_context(device);
+        if (context == nullptr)
+        {
+            std::cout << "    no context" << std::endl;
+            continue;
+        }
+        created++;
+
+        context->activate();
+        auto func = context->get_func();
+
+        const GLubyte* renderer = func->glGetString(GL_RENDERER);
+        std::cout << "    renderer: " << (renderer != nullptr ? reinterpret_cast<const char*>(renderer) : "-") << std::endl;
+
+        // the pinned context must be able to render, not just exist
+        GLuint texture = 0, framebuffer = 0;
+        func->glGenTextures(1, &texture);
+        func->glBindTexture(GL_TEXTURE_2D, texture);
+        func->glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 4, 4, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        func->glGenFramebuffers(1, &framebuffer);
+        func->glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        func->glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+
+        uint8_t pixel[4] = {};
+        if (func->glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE)
+        {
+            func->glViewport(0, 0, 4, 4);
+            func->glClearColor(1.0f, 0.0f, 1.0f, 1.0f);
+            func->glClear(GL_COLOR_BUFFER_BIT);
+            func->glReadPixels(0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+        }
+        if (renderer == nullptr || pixel[0] != 255 || pixel[1] != 0 || pixel[2] != 255)
+            failed++;
+
+        func->glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        func->glDeleteFramebuffers(1, &framebuffer);
+        func->glBindTexture(GL_TEXTURE_2D, 0);
+        func->glDeleteTextures(1, &texture);
+
+        context->release();
+        GL::destroy_context(context);
+    }
+
+    std::cout << "contexts: " << created << ", failed: " << failed << std::endl;
+
+    return created > 0 && failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,69 @@
+#include <GLContext.h>
+#include <GLFunctionSet.h>
+
+#include <iostream>
+
+#ifdef GL_ES
+static constexpr bool Use_ES = true;
+#else
+static constexpr bool Use_ES = false;
+#endif
+static constexpr int Major_Version = 3;
+
+// only what the sample calls, checked against the version at compile time
+using Functions = GL::GLFunctionSet<GL::GLVersion{Use_ES, Major_Version, 0},
+    GL_PROC(glGenTextures),
+    GL_PROC(glBindTexture),
+    GL_PROC(glTexParameteri),
+    GL_PROC(glGetTexParameteriv),
+    GL_PROC(glIsTexture),
+    GL_PROC(glDeleteTextures)>;
+
+// no driver reports this, load must refuse it even though every symbol resolves
+using FutureFunctions = GL::GLFunctionSet<GL::GLVersion{Use_ES, 99, 0}, GL_PROC(glBindTexture)>;
+
+int main()
+{
+    GL::GLContext* context = GL::create_offscreen_context(false);
+    context->activate();
+
+    int major = 0, minor = 0;
+    context->version(&major, &minor);
+    std::cout << "context version: " << major << "." << minor << ", es: " << context->is_opengl_es() << std::endl;
+
+    int failed = 0;
+
+    Functions functions;
+    if (context->is_opengl_es() != Use_ES || major < Major_Version)
+        std::cout << "context doesn't provide the declared version, skipping calls" << std::endl;
+    else if (!functions.load(context))
+        failed++;
+    else
+    {
+        GLuint texture = 0;
+        functions.get<&GL::GLFunctions::glGenTextures>()(1, &texture);
+        functions.get<&GL::GLFunctions::glBindTexture>()(GL_TEXTURE_2D, texture);
+        functions.get<&GL::GLFunctions::glTexParameteri>()(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+
+        GLint filter = 0;
+        functions.get<&GL::GLFunctions::glGetTexParameteriv>()(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, &filter);
+        if (filter != GL_NEAREST || functions.get<&GL::GLFunctions::glIsTexture>()(texture) != GL_TRUE)
+            failed++;
+
+        functions.get<&GL::GLFunctions::glBindTexture>()(GL_TEXTURE_2D, 0);
+        functions.get<&GL::GLFunctions::glDeleteTextures>()(1, &texture);
+        if (functions.get<&GL::GLFunctions::glIsTexture>()(texture) != GL_FALSE)
+            failed++;
+    }
+
+    FutureFunctions future;
+    if (future.load(context))
+        failed++;
+
+    std::cout << "failed: " << failed << std::endl;
+
+    context->release();
+    GL::destroy_context(context);
+
+    return failed == 0 ? 0 : 1;
+}
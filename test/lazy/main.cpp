@@ -0,0 +1,47 @@
+#include <GLContext.h>
+#include <GLFunctions.h>
+#include <GLFunctionSet.h>
+
+#include <iostream>
+
+int main()
+{
+    GL::set_lazy_function_loading(true);
+
+    GL::GLContext* context = GL::create_offscreen_context(false);
+    context->activate();
+
+    auto func = context->get_func();
+    int failed = 0;
+
+    // nothing in context creation sets the blend color, the slot must still hold the trampoline
+    void* driver = GL::get_proc_address("glBlendColor");
+    void* before = reinterpret_cast<void*>(func->glBlendColor);
+    if (driver == nullptr || before == nullptr || before == driver)
+        failed++;
+
+    func->glBlendColor(0.25f, 0.5f, 0.75f, 1.0f);
+
+    void* after = reinterpret_cast<void*>(func->glBlendColor);
+    if (after != driver)
+        failed++;
+
+    // the first call went through to the driver as well
+    GLfloat color[4] = {};
+    func->glGetFloatv(GL_BLEND_COLOR, color);
+    if (color[0] != 0.25f || color[1] != 0.5f || color[2] != 0.75f || color[3] != 1.0f)
+        failed++;
+
+    // a second call takes the patched slot
+    func->glBlendColor(0.0f, 0.0f, 0.0f, 0.0f);
+    func->glGetFloatv(GL_BLEND_COLOR, color);
+    if (color[0] != 0.0f || func->glGetError() != GL_NO_ERROR)
+        failed++;
+
+    std::cout << "trampoline: " << before << ", patched: " << after << ", failed: " << failed << std::endl;
+
+    context->release();
+    GL::destroy_context(context);
+
+    return failed == 0 ? 0 : 1;
+}
@@ -1,10 +1,18 @@
 #include <GLContext.h>
+#include <GLFence.h>
+#include <GLFrameQueue.h>
+#include <GLFramebuffer.h>
 #include <GLFunctions.h>
+#include <GLStateCache.h>
 #include <GLTexture.h>
+#include <GLTexturePool.h>
+#include <GLUploadRing.h>
 
+#include <cstring>
 #include <thread>
 #include <future>
 #include <iostream>
+#include <vector>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
@@ -12,33 +20,29 @@
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include <stb_image_write.h>
 
-#include <queue.h>
-
-struct Texture
-{
-    int width;
-    int height;
-    int channels;
-    GLuint id;
-    // in wgl, texture must sync manually, while egl doesn't
-    GLsync sync;
-};
-
-Queue<Texture> texture_queue;
-
 static constexpr size_t Queue_Max_Size = 2;
 static constexpr size_t Loop_Max_Count = 100;
+static constexpr size_t Upload_Slot_Count = 3;
+static constexpr size_t Texture_Pool_Budget = 256 * 1024 * 1024;
+
+// the producer parks while it is full, the consumer while it is empty
+GL::GLSpscQueue<GL::GLFrame> texture_queue(Queue_Max_Size);
+
+// owned by the producer, the consumer hands textures back once it is done with them
+GL::GLTexturePool* texture_pool = nullptr;
 
 std::atomic<bool> produce_initialize = false;
 std::atomic<bool> consume_initialize = false;
 std::atomic<bool> consume_stop = false;
+std::atomic<size_t> failed = 0;
 
 void produce()
 {
     GL::GLContext* context = GL::create_offscreen_context();
     produce_initialize = true;
+    produce_initialize.notify_one();
 
-    while (!consume_initialize) {}
+    consume_initialize.wait(false);
 
     // wgl must wait all shared context initialized, while egl doesn't
     context->activate();
@@ -48,84 +52,110 @@ void produce()
     int width, height, channels;
     uint8_t* image = stbi_load(ASSETS_DIR"a.png", &width, &height, &channels, STBI_rgb_alpha);
 
-    size_t loop_count = 0;
-    while (true)
-    {
-        if (loop_count >= Loop_Max_Count)
-            break;
+    GL::GLUploadRing* upload_ring = new GL::GLUploadRing(width * height * 4, Upload_Slot_Count);
+    texture_pool = new GL::GLTexturePool(Texture_Pool_Budget);
 
-        if (texture_queue.size() < Queue_Max_Size)
-        {
-            GLuint v;
-            func->glGenTextures(1, &v);
-            func->glBindTexture(GL_TEXTURE_2D, v);
-            func->glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, image);
-            func->glBindTexture(GL_TEXTURE_2D, 0);
+    for (size_t loop_count = 0; loop_count < Loop_Max_Count; loop_count++)
+    {
+        GL::GLTexture* v = texture_pool->acquire(width, height, GL_RGBA8);
 
-            GLsync sync = func->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
-            func->glFlush();
+        // stands in for a decoder writing straight into the mapped slot
+        GL::GLUploadRing::Slot slot = upload_ring->acquire();
+        std::memcpy(slot.data, image, width * height * 4);
+        upload_ring->upload(slot, *v, GL_RGBA, GL_UNSIGNED_BYTE);
 
-            Texture texture{width, height, 4, v, sync};
-            texture_queue.enqueue(texture);
+        // in wgl, texture must sync manually, while egl doesn't
+        GL::GLFence fence(context);
+        func->glFlush();
 
-            loop_count++;
-        }
+        // the consumer takes the sync over and deletes it
+        texture_queue.push({v, fence.release()});
     }
 
+    std::cout << "upload ring persistent: " << upload_ring->is_persistent() << ", stalls: " << upload_ring->stall_count() << std::endl;
+    delete upload_ring;
+
     stbi_image_free(image);
     context->release();
 
-    while (!consume_stop) {}
+    consume_stop.wait(false);
+
+    GL::GLTexturePoolStats stats = texture_pool->stats();
+    std::cout << "texture pool hits: " << stats.hits << ", misses: " << stats.misses
+              << ", resident: " << stats.bytes_resident / (1024 * 1024) << " MB" << std::endl;
+
+    context->activate();
+    delete texture_pool;
+    context->release();
     GL::destroy_context(context);
 }
 
 void consume()
 {
-    while (!produce_initialize) {}
+    produce_initialize.wait(false);
 
     GL::create_offscreen_context();
 
     consume_initialize = true;
+    consume_initialize.notify_one();
 
     auto context = GL::GLContext::current_context();
 
     std::cout << "is opengles: " << context->is_opengl_es() << std::endl;
 
-    auto func = context->get_func();
-
     context->activate();
 
     auto start = std::chrono::high_resolution_clock::now();
 
-    GLuint fbo;
-    func->glGenFramebuffers(1, &fbo);
-    func->glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-
-    size_t loop_count = 0;
-    while (true)
+    // pooled textures come back, so each one is validated only once
+    GL::GLFramebufferCache* framebuffers = new GL::GLFramebufferCache();
+    // hands textures back to the pool once the gpu is done reading them, without this thread waiting
+    GL::GLFenceWatcher* watcher = new GL::GLFenceWatcher();
+    if (!watcher->valid())
     {
-        if (loop_count >= Loop_Max_Count)
-            break;
+        std::cout << "fence watcher has no context" << std::endl;
+        failed++;
+    }
 
-        if (!texture_queue.empty())
-        {
-            Texture texture = texture_queue.dequeue();
+    for (size_t loop_count = 0; loop_count < Loop_Max_Count; loop_count++)
+    {
+        GL::GLFrame frame = texture_queue.pop();
 
-            func->glWaitSync(texture.sync, 0, GL_TIMEOUT_IGNORED);
-            func->glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture.id, 0);
+        GL::GLFence upload_fence(frame.sync, context);
+        upload_fence.server_wait();
+        // keep draining the queue on failure so the producer never parks forever
+        GL::GLFramebuffer const* framebuffer = framebuffers->get(*frame.texture);
+        if (framebuffer != nullptr)
+            framebuffer->bind();
+        else
+            failed++;
 
-            //std::vector<uint8_t> v(texture.height * texture.width * texture.channels);
-            //func->glReadPixels(0, 0, texture.width, texture.height, GL_RGBA, GL_UNSIGNED_BYTE, v.data());
+        //std::vector<uint8_t> v(frame.texture->height() * frame.texture->width() * 4);
+        //context->get_func()->glReadPixels(0, 0, frame.texture->width(), frame.texture->height(), GL_RGBA, GL_UNSIGNED_BYTE, v.data());
 
-            //stbi_write_png((std::to_string(loop_count) + ".png").c_str(), texture.width, texture.height, texture.channels, v.data(), 0);
+        //stbi_write_png((std::to_string(loop_count) + ".png").c_str(), frame.texture->width(), frame.texture->height(), 4, v.data(), 0);
 
-            loop_count++;
+        GL::GLFence fence(context);
+        if (!watcher->valid())
+        {
+            // nobody polls, wait here so the texture isn't reused while the gpu still reads it
+            fence.client_wait();
+            texture_pool->release(frame.texture);
         }
+        else
+            watcher->on_signaled(std::move(fence), [texture = frame.texture] { texture_pool->release(texture); });
     }
 
-    func->glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    // runs the callbacks still pending, the pool must get every texture back before it is deleted
+    delete watcher;
 
-    func->glDeleteFramebuffers(1, &fbo);
+    context->get_state()->bind_framebuffer(GL_FRAMEBUFFER, 0);
+
+    std::cout << "framebuffer cache hits: " << framebuffers->hit_count() << ", misses: " << framebuffers->miss_count() << std::endl;
+
+    GL::GLStateCacheStats state_stats = context->get_state()->stats();
+    std::cout << "state calls issued: " << state_stats.issued << ", elided: " << state_stats.elided << std::endl;
+    delete framebuffers;
 
     auto end = std::chrono::high_resolution_clock::now();
     std::chrono::duration<double> diff = end - start;
@@ -135,6 +165,7 @@ void consume()
     GL::destroy_context(context);
 
     consume_stop = true;
+    consume_stop.notify_one();
 }
 
 int main()
@@ -144,5 +175,8 @@ int main()
     t1.join();
     t2.join();
 
-    return 0;
+    if (failed != 0)
+        std::cout << "incomplete framebuffers: " << failed << std::endl;
+
+    return failed == 0 ? 0 : 1;
 }
\ No newline at end of file
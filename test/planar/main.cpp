@@ -0,0 +1,163 @@
+#include <GLColorConverter.h>
+#include <GLContext.h>
+#include <GLFramebuffer.h>
+#include <GLFunctions.h>
+#include <GLPlanarTexture.h>
+#include <GLTexture.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// odd chroma width and strides wider than the planes, padding must never reach the texture
+static constexpr int Width = 250;
+static constexpr int Height = 120;
+static constexpr int Chroma_Width = (Width + 1) / 2;
+static constexpr int Chroma_Height = (Height + 1) / 2;
+static constexpr int Luma_Padding = 14;
+static constexpr int Chroma_Padding = 11;
+static constexpr int Tolerance = 2;
+// uploads must leave the caller's unpack state alone
+static constexpr GLint Caller_Alignment = 2;
+
+static int luma(int x, int y)
+{
+    return (x * 3 + y * 5) % 200 + 20;
+}
+
+// neutral chroma turns full range yuv into gray, padding is filled so a wrong stride shows up as color
+static size_t convert_and_check(GL::GLContext* context, GL::GLColorConverter& converter, GL::GLPlanarTexture const& frame,
+    std::vector<GL::GLPlane> const& planes, int (*expected)(int x, int y))
+{
+    auto func = context->get_func();
+
+    func->glPixelStorei(GL_UNPACK_ALIGNMENT, Caller_Alignment);
+    frame.upload(planes);
+
+    size_t mismatches = 0;
+    GLint alignment = 0;
+    func->glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+    if (alignment != Caller_Alignment)
+        mismatches++;
+    func->glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    GL::GLTexture* result = new GL::GLTexture(Width, Height, GL_RGBA8, GL_RGBA, context);
+    converter.to_rgba(frame, *result, GL::ColorSpace::bt601, GL::ColorRange::full);
+
+    GL::GLFramebuffer* framebuffer = new GL::GLFramebuffer(context);
+    framebuffer->attach_color(0, *result);
+    if (!framebuffer->validate())
+    {
+        std::cout << "incomplete framebuffer" << std::endl;
+        mismatches++;
+    }
+    else
+    {
+        std::vector<uint8_t> pixels(static_cast<size_t>(Width) * Height * 4);
+        framebuffer->bind();
+        func->glReadPixels(0, 0, Width, Height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        framebuffer->unbind();
+
+        for (int y = 0; y < Height; y++)
+        {
+            for (int x = 0; x < Width; x++)
+            {
+                uint8_t const* pixel = &pixels[(static_cast<size_t>(y) * Width + x) * 4];
+                for (int c = 0; c < 3; c++)
+                {
+                    if (std::abs(pixel[c] - expected(x, y)) > Tolerance)
+                        mismatches++;
+                }
+            }
+        }
+    }
+
+    delete framebuffer;
+    delete result;
+    return mismatches;
+}
+
+static size_t check_i420(GL::GLContext* context, GL::GLColorConverter& converter)
+{
+    GL::GLPlanarTexture frame(Width, Height, GL::YUVFormat::i420, context);
+
+    int luma_stride = Width + Luma_Padding;
+    int chroma_stride = Chroma_Width + Chroma_Padding;
+
+    std::vector<uint8_t> y(static_cast<size_t>(luma_stride) * Height, 0xFF);
+    std::vector<uint8_t> u(static_cast<size_t>(chroma_stride) * Chroma_Height, 0x00);
+    std::vector<uint8_t> v(u.size(), 0x00);
+    for (int row = 0; row < Height; row++)
+    {
+        for (int x = 0; x < Width; x++)
+            y[static_cast<size_t>(row) * luma_stride + x] = static_cast<uint8_t>(luma(x, row));
+    }
+    for (int row = 0; row < Chroma_Height; row++)
+    {
+        std::memset(&u[static_cast<size_t>(row) * chroma_stride], 128, Chroma_Width);
+        std::memset(&v[static_cast<size_t>(row) * chroma_stride], 128, Chroma_Width);
+    }
+
+    std::vector<GL::GLPlane> planes = {{y.data(), luma_stride}, {u.data(), chroma_stride}, {v.data(), chroma_stride}};
+    return convert_and_check(context, converter, frame, planes, luma);
+}
+
+// 10 bit luma scaled from the 8 bit pattern, back to 8 bit the way the converter normalizes it
+static int p010_luma(int x, int y)
+{
+    int value = luma(x, y) * 4;
+    return (value * 255 + 511) / 1023;
+}
+
+static size_t check_p010(GL::GLContext* context, GL::GLColorConverter& converter)
+{
+    GL::GLPlanarTexture frame(Width, Height, GL::YUVFormat::p010, context);
+
+    // strides are in bytes, samples are 16 bit with the value in the top 10 bits
+    int luma_stride = (Width + Luma_Padding) * 2;
+    int chroma_stride = (Chroma_Width + Chroma_Padding) * 4;
+
+    std::vector<uint16_t> y(static_cast<size_t>(luma_stride / 2) * Height, 0xFFFF);
+    std::vector<uint16_t> uv(static_cast<size_t>(chroma_stride / 2) * Chroma_Height, 0x0000);
+    for (int row = 0; row < Height; row++)
+    {
+        for (int x = 0; x < Width; x++)
+            y[static_cast<size_t>(row) * (luma_stride / 2) + x] = static_cast<uint16_t>(luma(x, row) * 4 << 6);
+    }
+    for (int row = 0; row < Chroma_Height; row++)
+    {
+        for (int x = 0; x < Chroma_Width * 2; x++)
+            uv[static_cast<size_t>(row) * (chroma_stride / 2) + x] = static_cast<uint16_t>(512 << 6);
+    }
+
+    std::vector<GL::GLPlane> planes = {{y.data(), luma_stride}, {uv.data(), chroma_stride}};
+    return convert_and_check(context, converter, frame, planes, p010_luma);
+}
+
+int main()
+{
+    GL::GLContext* context = GL::create_offscreen_context(false);
+    context->activate();
+
+    GL::GLColorConverter* converter = new GL::GLColorConverter(context);
+
+    size_t i420 = check_i420(context, *converter);
+    std::cout << "i420 mismatched channels: " << i420 << std::endl;
+
+    size_t p010 = 0;
+    if (GL::GLPlanarTexture::is_supported(GL::YUVFormat::p010, context))
+    {
+        p010 = check_p010(context, *converter);
+        std::cout << "p010 mismatched channels: " << p010 << std::endl;
+    }
+    else
+        std::cout << "p010 unsupported, skipping" << std::endl;
+
+    delete converter;
+
+    context->release();
+    GL::destroy_context(context);
+
+    return i420 == 0 && p010 == 0 ? 0 : 1;
+}
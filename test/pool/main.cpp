@@ -0,0 +1,97 @@
+#include <GLContext.h>
+#include <GLContextPool.h>
+#include <GLFunctions.h>
+#include <GLShareGroup.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+static constexpr size_t Pool_Size = 2;
+static constexpr size_t Thread_Count = 4;
+static constexpr size_t Loop_Max_Count = 50;
+
+int main()
+{
+    GL::GLShareGroup group;
+    std::atomic<size_t> failed = 0;
+
+    // the pool is built on this thread while it has a context of its own current
+    GL::GLContext* anchor = GL::create_offscreen_context(group);
+    anchor->activate();
+
+    auto func = anchor->get_func();
+    GLuint texture;
+    func->glGenTextures(1, &texture);
+    func->glBindTexture(GL_TEXTURE_2D, texture);
+    func->glBindTexture(GL_TEXTURE_2D, 0);
+    func->glFinish();
+
+    auto pool = new GL::GLContextPool(Pool_Size, group);
+    if (pool->capacity() != Pool_Size)
+        failed++;
+    // none of the pooled contexts may stay current here, they'd be unusable by the leasing threads
+    if (GL::GLContext::current_context() != anchor)
+        failed++;
+    anchor->release();
+
+    std::atomic<size_t> leased = 0;
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < Thread_Count; t++)
+    {
+        threads.emplace_back([&]
+        {
+            for (size_t loop = 0; loop < Loop_Max_Count; loop++)
+            {
+                GL::GLContextPool::Lease lease = pool->acquire();
+                if (!lease || GL::GLContext::current_context() != lease.context())
+                {
+                    failed++;
+                    continue;
+                }
+
+                auto lease_func = lease->get_func();
+                if (lease_func->glIsTexture(texture) != GL_TRUE)
+                    failed++;
+
+                GLuint scratch;
+                lease_func->glGenTextures(1, &scratch);
+                lease_func->glBindTexture(GL_TEXTURE_2D, scratch);
+                lease_func->glDeleteTextures(1, &scratch);
+                if (lease_func->glGetError() != GL_NO_ERROR)
+                    failed++;
+
+                leased++;
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> diff = end - start;
+
+    GL::GLContextPoolStats stats = pool->stats();
+    if (stats.in_use != 0 || stats.acquire_count != Thread_Count * Loop_Max_Count || stats.peak_in_use > Pool_Size)
+        failed++;
+
+    delete pool;
+
+    anchor->activate();
+    anchor->get_func()->glDeleteTextures(1, &texture);
+    anchor->release();
+    GL::destroy_context(anchor);
+
+    std::cout << "leased: " << leased << ", failed: " << failed << std::endl;
+    std::cout << "peak in use: " << stats.peak_in_use << ", max acquire latency: "
+              << std::chrono::duration<double, std::micro>(stats.max_acquire_latency).count() << " us" << std::endl;
+    std::cout << diff.count() << " seconds" << std::endl;
+
+    return failed == 0 ? 0 : 1;
+}
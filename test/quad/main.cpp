@@ -3,8 +3,11 @@
 //
 
 #include <GLContext.h>
+#include <GLFramebuffer.h>
 #include <GLFunctions.h>
 #include <GLProgram.h>
+#include <GLReadbackQueue.h>
+#include <GLStateCache.h>
 #include <GLTexture.h>
 #include <GLVao.h>
 
@@ -13,6 +16,7 @@
 
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include <stb_image_write.h>
+#include <iostream>
 #include <vector>
 
 #include "renderdoc_load.h"
@@ -94,42 +98,38 @@ int main()
     program->attach_shader(GL::ShaderType::Fragment, FragmentShader);
     program->link();
 
-    GL::GLTexture* texture = new GL::GLTexture(s_width, s_height, GL_RGBA, GL_RGBA);
-    func->glBindTexture(GL_TEXTURE_2D, texture->id());
-    func->glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, s_width, s_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
-    func->glBindTexture(GL_TEXTURE_2D, 0);
+    GL::GLTexture* texture = new GL::GLTexture(s_width, s_height, GL_RGBA8, GL_RGBA);
 
-    GLuint fbo;
-    func->glGenFramebuffers(1, &fbo);
-    func->glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-    func->glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture->id(), 0);
-    func->glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    GL::GLFramebuffer* framebuffer = new GL::GLFramebuffer();
+    framebuffer->attach_color(0, *texture);
+    if (!framebuffer->validate())
+    {
+        std::cout << "incomplete framebuffer" << std::endl;
+        return 1;
+    }
 
-    GL::GLTexture* tex = new GL::GLTexture(width, height, GL_RGBA, GL_RGBA);
-    func->glBindTexture(GL_TEXTURE_2D, tex->id());
-    func->glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, image);
+    GL::GLTexture* tex = new GL::GLTexture(width, height, GL_RGBA8, GL_RGBA, GL::GLTexture::mip_levels(width, height));
+    tex->upload(image, GL_RGBA, GL_UNSIGNED_BYTE);
+    tex->generate_mipmaps();
+    tex->set_filter(GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR);
+    tex->set_wrap(GL_REPEAT, GL_REPEAT);
 
     //while (true)
     //{
         if (s_renderdoc_api)
             s_renderdoc_api->StartFrameCapture(nullptr, nullptr);
 
-        func->glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        framebuffer->bind();
 
         func->glClearColor(0.0, 0.0, 0.0, 1.0);
         func->glClear(GL_COLOR_BUFFER_BIT);
-        func->glDisable(GL_DEPTH_TEST);
+        GL::GLStateCache* state = context->get_state();
+        state->set_enabled(GL_DEPTH_TEST, false);
 
         program->use();
 
-        func->glActiveTexture(GL_TEXTURE0);
-        func->glBindTexture(GL_TEXTURE_2D, tex->id());
-        func->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        func->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        func->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        func->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        state->bind_texture(0, GL_TEXTURE_2D, tex->id());
 
-        func->glViewport(0, 0, texture->width(), texture->height());
         func->glDrawArrays(GL_TRIANGLES, 0, 3);
 
         program->release();
@@ -138,12 +138,19 @@ int main()
             s_renderdoc_api->EndFrameCapture(nullptr, nullptr);
     //}
 
-    func->glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-    std::vector<uint8_t> v(texture->height() * texture->width() * 4);
-    func->glReadPixels(0, 0, texture->width(), texture->height(), GL_RGBA, GL_UNSIGNED_BYTE, v.data());
+    GL::GLReadbackQueue* readback = new GL::GLReadbackQueue(texture->width(), texture->height());
 
-    stbi_write_png("f.png", texture->width(), texture->height(), 4, v.data(), 0);
+    framebuffer->bind();
+    readback->enqueue();
+    framebuffer->unbind();
 
+    // rendering of the next frame would go here, overlapping the copy
+    if (auto frame = readback->dequeue())
+        stbi_write_png("f.png", texture->width(), texture->height(), 4, frame->data().data(), static_cast<int>(frame->stride()));
+
+    delete readback;
+
+    delete framebuffer;
     delete texture;
     delete program;
     delete tex;
@@ -0,0 +1,111 @@
+#include <GLFrameQueue.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+static constexpr size_t Queue_Max_Size = 4;
+static constexpr size_t Producer_Count = 4;
+static constexpr size_t Consumer_Count = 4;
+static constexpr size_t Item_Count = 20000;
+// long enough for every thread of the waiting side to run out of spins and park
+static constexpr auto Park_Delay = std::chrono::milliseconds(100);
+
+struct RunResult
+{
+    size_t      missing     = 0;
+    size_t      duplicated  = 0;
+    uint64_t    push_stalls = 0;
+    uint64_t    pop_stalls  = 0;
+};
+
+// producers_first starts the producers against no consumers so they fill the ring and park,
+// otherwise the consumers start against an empty ring and park
+static RunResult run(bool producers_first)
+{
+    GL::GLMpmcQueue<size_t> queue(Queue_Max_Size);
+    std::unique_ptr<std::atomic<uint32_t>[]> seen(new std::atomic<uint32_t>[Item_Count]);
+    for (size_t i = 0; i < Item_Count; i++)
+        seen[i] = 0;
+
+    auto produce = [&](size_t producer)
+    {
+        for (size_t i = producer; i < Item_Count; i += Producer_Count)
+            queue.push(i);
+    };
+
+    auto consume = [&]
+    {
+        for (size_t i = 0; i < Item_Count / Consumer_Count; i++)
+            seen[queue.pop()]++;
+    };
+
+    std::vector<std::thread> first;
+    std::vector<std::thread> second;
+    for (size_t i = 0; i < (producers_first ? Producer_Count : Consumer_Count); i++)
+    {
+        if (producers_first)
+            first.emplace_back(produce, i);
+        else
+            first.emplace_back(consume);
+    }
+
+    std::this_thread::sleep_for(Park_Delay);
+
+    for (size_t i = 0; i < (producers_first ? Consumer_Count : Producer_Count); i++)
+    {
+        if (producers_first)
+            second.emplace_back(consume);
+        else
+            second.emplace_back(produce, i);
+    }
+
+    for (auto& thread : first)
+        thread.join();
+    for (auto& thread : second)
+        thread.join();
+
+    RunResult result;
+    for (size_t i = 0; i < Item_Count; i++)
+    {
+        if (seen[i] == 0)
+            result.missing++;
+        else if (seen[i] > 1)
+            result.duplicated++;
+    }
+    result.push_stalls = queue.push_stall_count();
+    result.pop_stalls = queue.pop_stall_count();
+
+    if (!queue.empty())
+        result.missing++;
+
+    return result;
+}
+
+int main()
+{
+    static_assert(Item_Count % Producer_Count == 0 && Item_Count % Consumer_Count == 0);
+
+    size_t failed = 0;
+    for (bool producers_first : {false, true})
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        RunResult result = run(producers_first);
+        std::chrono::duration<double, std::milli> diff = std::chrono::high_resolution_clock::now() - start;
+
+        std::cout << (producers_first ? "producers first" : "consumers first") << ": missing " << result.missing
+                  << ", duplicated " << result.duplicated << ", push stalls " << result.push_stalls
+                  << ", pop stalls " << result.pop_stalls << ", " << diff.count() << " ms" << std::endl;
+
+        if (result.missing != 0 || result.duplicated != 0)
+            failed++;
+        // the side started first must have parked while the other one was held back
+        if ((producers_first ? result.push_stalls : result.pop_stalls) == 0)
+            failed++;
+    }
+
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,92 @@
+#include <GLContext.h>
+#include <GLFunctions.h>
+#include <GLShareGroup.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+static constexpr size_t Group_Count = 2;
+static constexpr size_t Thread_Count = 8;
+static constexpr size_t Loop_Max_Count = 50;
+
+int main()
+{
+    GL::GLShareGroup groups[Group_Count];
+    GL::GLContext* anchors[Group_Count];
+    GLuint textures[Group_Count];
+
+    // each group keeps one context alive holding a texture its members must see
+    for (size_t i = 0; i < Group_Count; i++)
+    {
+        anchors[i] = GL::create_offscreen_context(groups[i]);
+        anchors[i]->activate();
+
+        auto func = anchors[i]->get_func();
+        func->glGenTextures(1, &textures[i]);
+        func->glBindTexture(GL_TEXTURE_2D, textures[i]);
+        func->glBindTexture(GL_TEXTURE_2D, 0);
+        func->glFinish();
+
+        anchors[i]->release();
+    }
+
+    std::atomic<size_t> created = 0;
+    std::atomic<size_t> failed = 0;
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < Thread_Count; t++)
+    {
+        threads.emplace_back([&, t]
+        {
+            for (size_t loop = 0; loop < Loop_Max_Count; loop++)
+            {
+                size_t index = (t + loop) % Group_Count;
+
+                GL::GLContext* context = GL::create_offscreen_context(groups[index]);
+                if (context == nullptr)
+                {
+                    failed++;
+                    continue;
+                }
+
+                context->activate();
+                if (context->get_func()->glIsTexture(textures[index]) != GL_TRUE)
+                    failed++;
+                context->release();
+
+                GL::destroy_context(context);
+                created++;
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> diff = end - start;
+
+    for (size_t i = 0; i < Group_Count; i++)
+    {
+        anchors[i]->activate();
+        anchors[i]->get_func()->glDeleteTextures(1, &textures[i]);
+        anchors[i]->release();
+        GL::destroy_context(anchors[i]);
+    }
+
+    std::cout << "created: " << created << ", failed: " << failed << std::endl;
+    std::cout << diff.count() << " seconds" << std::endl;
+
+    for (size_t i = 0; i < Group_Count; i++)
+    {
+        if (groups[i].size() != 0)
+            failed++;
+    }
+
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,55 @@
+#include <GLContext.h>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+static constexpr size_t Context_Count = 32;
+static constexpr size_t Activate_Count = 10000;
+
+int main()
+{
+    std::vector<GL::GLContext*> contexts;
+    contexts.reserve(Context_Count);
+
+    double total = 0.0;
+    for (size_t i = 0; i < Context_Count; i++)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        GL::GLContext* context = GL::create_offscreen_context();
+        auto end = std::chrono::high_resolution_clock::now();
+
+        if (context == nullptr)
+        {
+            std::cout << "failed to create context " << i << std::endl;
+            break;
+        }
+        contexts.push_back(context);
+
+        std::chrono::duration<double, std::milli> diff = end - start;
+        total += diff.count();
+        std::cout << "context " << i << ": " << diff.count() << " ms" << std::endl;
+    }
+
+    if (!contexts.empty())
+        std::cout << "average: " << total / static_cast<double>(contexts.size()) << " ms" << std::endl;
+
+    if (contexts.size() >= 2)
+    {
+        // re-activating the current context must not reach the driver
+        uint64_t switches = GL::GLContext::switch_count();
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < Activate_Count; i++)
+            contexts[(i / 100) % 2]->activate();
+        auto end = std::chrono::high_resolution_clock::now();
+
+        std::chrono::duration<double, std::micro> diff = end - start;
+        std::cout << "activate: " << diff.count() / Activate_Count << " us, "
+                  << GL::GLContext::switch_count() - switches << " switches for " << Activate_Count << " calls" << std::endl;
+    }
+
+    for (auto context : contexts)
+        GL::destroy_context(context);
+
+    return 0;
+}
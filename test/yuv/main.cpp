@@ -0,0 +1,110 @@
+#include <GLColorConverter.h>
+#include <GLContext.h>
+#include <GLFramebuffer.h>
+#include <GLFunctions.h>
+#include <GLPlanarTexture.h>
+#include <GLProgram.h>
+#include <GLProgramCache.h>
+#include <GLTexture.h>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// round trip through nv12 loses chroma resolution, flat areas must survive almost unchanged
+static constexpr int Max_Mean_Error = 4;
+
+int main()
+{
+    GL::GLContext* context = GL::create_offscreen_context(false);
+    context->activate();
+
+    auto func = context->get_func();
+
+    int width, height, channels;
+    uint8_t* image = stbi_load(ASSETS_DIR"a.png", &width, &height, &channels, STBI_rgb_alpha);
+
+    GL::GLTexture* source = new GL::GLTexture(width, height, GL_RGBA8, GL_RGBA);
+    source->upload(image, GL_RGBA, GL_UNSIGNED_BYTE);
+
+    GL::GLPlanarTexture* frame = new GL::GLPlanarTexture(width, height, GL::YUVFormat::nv12);
+    GL::GLTexture* result = new GL::GLTexture(width, height, GL_RGBA8, GL_RGBA);
+
+    // the second run links the conversion programs from binaries instead of compiling them
+    GL::GLProgramCache* program_cache = new GL::GLProgramCache("yuv_programs.bin");
+    GL::GLProgram::set_binary_cache(program_cache);
+
+    GL::GLColorConverter* converter = new GL::GLColorConverter();
+
+    GL::GLFramebuffer* framebuffer = new GL::GLFramebuffer();
+    framebuffer->attach_color(0, *result);
+    if (!framebuffer->validate())
+    {
+        std::cout << "incomplete framebuffer" << std::endl;
+        return 1;
+    }
+
+    std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    bool first = true;
+
+    int failed = 0;
+    for (auto space : {GL::ColorSpace::bt601, GL::ColorSpace::bt709, GL::ColorSpace::bt2020})
+    {
+        for (auto range : {GL::ColorRange::limited, GL::ColorRange::full})
+        {
+            converter->to_nv12(*source, frame->plane(0), frame->plane(1), space, range);
+            converter->to_rgba(*frame, *result, space, range);
+
+            if (first)
+            {
+                func->glFinish();
+                std::chrono::duration<double, std::milli> diff = std::chrono::high_resolution_clock::now() - start;
+                std::cout << "first round trip: " << diff.count() << " ms, cached programs: " << program_cache->size() << std::endl;
+                first = false;
+            }
+
+            framebuffer->bind();
+            func->glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+            framebuffer->unbind();
+
+            uint64_t total = 0;
+            for (size_t i = 0; i < pixels.size(); i += 4)
+            {
+                for (size_t c = 0; c < 3; c++)
+                    total += std::abs(pixels[i + c] - image[i + c]);
+            }
+            double mean = static_cast<double>(total) / (static_cast<double>(pixels.size()) / 4 * 3);
+
+            std::cout << "space " << static_cast<int>(space) << " range " << static_cast<int>(range) << ": mean error " << mean << std::endl;
+            if (mean > Max_Mean_Error)
+                failed++;
+        }
+    }
+
+    stbi_write_png("yuv.png", width, height, 4, pixels.data(), 0);
+
+    delete framebuffer;
+    delete converter;
+    GL::GLProgram::set_binary_cache(nullptr);
+    delete program_cache;
+    delete result;
+    delete frame;
+    delete source;
+
+    stbi_image_free(image);
+
+    context->release();
+    GL::destroy_context(context);
+
+    return failed;
+}